@@ -5,6 +5,7 @@ cbuffer MatrixBuffer : register(b0)
     row_major matrix projectionMatrix;
     row_major matrix viewMatrix;
     row_major matrix modelMatrix;
+    row_major matrix normalMatrix;
 };
 
 struct VertexData
@@ -35,7 +36,7 @@ PixelData Main(VertexData input)
     
     output.position = worldPosition;
     output.color = float4(input.color, 1.0f);
-    float3 transformedNormal = mul(input.normal, (float3x3) transpose(Common_Inverse(modelMatrix)));
+    float3 transformedNormal = mul(input.normal, (float3x3) normalMatrix);
     output.normal = normalize(transformedNormal);
     output.uvs = input.uvs;
     
@@ -0,0 +1,55 @@
+#include <cstdlib>
+#include <new>
+
+#include "Benchmark.hpp"
+
+using Invasion::Benchmarks::AllocationCounter;
+
+namespace
+{
+	void* Allocate(std::size_t size)
+	{
+		AllocationCounter::Record(size);
+
+		if (void* pointer = std::malloc(size == 0 ? 1 : size))
+			return pointer;
+
+		throw std::bad_alloc();
+	}
+
+	void* AllocateAligned(std::size_t size, std::align_val_t alignment)
+	{
+		AllocationCounter::Record(size);
+
+		std::size_t align = static_cast<std::size_t>(alignment);
+
+		if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+			return pointer;
+
+		throw std::bad_alloc();
+	}
+}
+
+void* operator new(std::size_t size) { return Allocate(size); }
+void* operator new[](std::size_t size) { return Allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	try { return Allocate(size); } catch (...) { return nullptr; }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	try { return Allocate(size); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
\ No newline at end of file
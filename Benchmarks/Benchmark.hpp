@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Invasion::Benchmarks
+{
+	class AllocationCounter
+	{
+
+	public:
+
+		static void Record(size_t size) noexcept
+		{
+			allocations.fetch_add(1, std::memory_order_relaxed);
+			bytes.fetch_add(size, std::memory_order_relaxed);
+		}
+
+		static size_t GetAllocations() noexcept
+		{
+			return allocations.load(std::memory_order_relaxed);
+		}
+
+		static size_t GetBytes() noexcept
+		{
+			return bytes.load(std::memory_order_relaxed);
+		}
+
+	private:
+
+		static inline std::atomic<size_t> allocations = 0;
+		static inline std::atomic<size_t> bytes = 0;
+
+	};
+
+	struct Result
+	{
+		double nanosecondsPerOperation = 0.0;
+		double operationsPerSecond = 0.0;
+		double allocationsPerOperation = 0.0;
+		double bytesPerOperation = 0.0;
+	};
+
+	template <typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+
+		sink = &value;
+#endif
+	}
+
+	template <typename T>
+	inline void DoNotOptimize(T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : "+r,m"(value) : : "memory");
+#else
+		static volatile void* sink;
+
+		sink = &value;
+#endif
+	}
+
+	class Benchmark
+	{
+
+	public:
+
+		static void Initialize(int argumentCount, char** arguments)
+		{
+			for (int i = 1; i < argumentCount; ++i)
+			{
+				std::string_view argument = arguments[i];
+				const char* value = i + 1 < argumentCount ? arguments[i + 1] : nullptr;
+
+				if (argument == "--threads" && value)
+					threadCount = std::max<size_t>(std::strtoull(arguments[++i], nullptr, 10), 1);
+				else if (argument == "--repeat" && value)
+					repeatCount = std::max<size_t>(std::strtoull(arguments[++i], nullptr, 10), 1);
+				else if (argument == "--scale" && value)
+					scale = std::max(std::strtod(arguments[++i], nullptr), 0.0001);
+				else if (argument == "--filter" && value)
+					filter = arguments[++i];
+				else
+				{
+					std::printf("Usage: %s [--threads N] [--repeat N] [--scale F] [--filter TEXT]\n", arguments[0]);
+					std::exit(1);
+				}
+			}
+
+			std::printf("%-28s %-30s %7s %12s %12s %11s %11s\n", "group", "benchmark", "threads", "ns/op", "Mops/s", "allocs/op", "bytes/op");
+		}
+
+		static size_t GetThreadCount() noexcept
+		{
+			return threadCount;
+		}
+
+		static size_t Scale(size_t operations) noexcept
+		{
+			return std::max<size_t>(static_cast<size_t>(static_cast<double>(operations) * scale), 1);
+		}
+
+		static bool IsEnabled(std::string_view group, std::string_view name) noexcept
+		{
+			return filter.empty() || group.find(filter) != std::string_view::npos || name.find(filter) != std::string_view::npos;
+		}
+
+		template <typename Function>
+		static void Run(std::string_view group, std::string_view name, size_t operations, Function&& function)
+		{
+			if (!IsEnabled(group, name))
+				return;
+
+			Report(group, name, 1, Measure(1, operations, function));
+
+			if (threadCount > 1)
+				Report(group, name, threadCount, Measure(threadCount, operations, function));
+		}
+
+		template <typename Function>
+		static Result Measure(size_t threads, size_t operations, Function& function)
+		{
+			operations = Scale(operations);
+
+			Result best;
+
+			best.nanosecondsPerOperation = std::numeric_limits<double>::max();
+
+			for (size_t repeat = 0; repeat < repeatCount; ++repeat)
+			{
+				std::atomic<size_t> ready = 0;
+				std::atomic<bool> start = false;
+				std::vector<std::thread> workers;
+
+				workers.reserve(threads - 1);
+
+				for (size_t thread = 1; thread < threads; ++thread)
+				{
+					workers.emplace_back([&, thread]()
+					{
+						ready.fetch_add(1, std::memory_order_release);
+
+						while (!start.load(std::memory_order_acquire))
+							std::this_thread::yield();
+
+						function(thread, operations);
+					});
+				}
+
+				while (ready.load(std::memory_order_acquire) != threads - 1)
+					std::this_thread::yield();
+
+				size_t allocations = AllocationCounter::GetAllocations();
+				size_t bytes = AllocationCounter::GetBytes();
+
+				auto begin = std::chrono::steady_clock::now();
+
+				start.store(true, std::memory_order_release);
+
+				function(size_t{ 0 }, operations);
+
+				for (auto& worker : workers)
+					worker.join();
+
+				auto end = std::chrono::steady_clock::now();
+
+				double totalOperations = static_cast<double>(operations * threads);
+				double nanoseconds = std::chrono::duration<double, std::nano>(end - begin).count();
+
+				if (nanoseconds / static_cast<double>(operations) < best.nanosecondsPerOperation)
+				{
+					best.nanosecondsPerOperation = nanoseconds / static_cast<double>(operations);
+					best.operationsPerSecond = totalOperations / nanoseconds * 1e9;
+					best.allocationsPerOperation = static_cast<double>(AllocationCounter::GetAllocations() - allocations) / totalOperations;
+					best.bytesPerOperation = static_cast<double>(AllocationCounter::GetBytes() - bytes) / totalOperations;
+				}
+			}
+
+			return best;
+		}
+
+		static void Report(std::string_view group, std::string_view name, size_t threads, const Result& result)
+		{
+			std::printf("%-28.*s %-30.*s %7zu %12.2f %12.2f %11.3f %11.1f\n", static_cast<int>(group.size()), group.data(), static_cast<int>(name.size()), name.data(), threads, result.nanosecondsPerOperation, result.operationsPerSecond / 1e6, result.allocationsPerOperation, result.bytesPerOperation);
+		}
+
+	private:
+
+		static inline size_t threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		static inline size_t repeatCount = 5;
+		static inline double scale = 1.0;
+		static inline std::string_view filter;
+
+	};
+}
\ No newline at end of file
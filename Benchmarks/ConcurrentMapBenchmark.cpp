@@ -0,0 +1,156 @@
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Benchmark.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Util;
+
+namespace
+{
+	constexpr size_t ThreadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+	constexpr uint64_t KeyCount = 1 << 16;
+
+	struct Workload
+	{
+		std::string_view name;
+		uint32_t writePercent;
+		uint64_t keyCount;
+	};
+
+	constexpr Workload Workloads[] =
+	{
+		{ "read-only", 0, KeyCount },
+		{ "read-95", 5, KeyCount },
+		{ "mixed-50", 50, KeyCount },
+		{ "write-only", 100, KeyCount },
+		{ "hot-key-95", 5, 16 }
+	};
+
+	template <typename Mutex>
+	class LockedUnorderedMap
+	{
+
+	public:
+
+		void Insert(uint64_t key, uint64_t value)
+		{
+			std::unique_lock lock(mutex);
+
+			map.insert_or_assign(key, value);
+		}
+
+		uint64_t Find(uint64_t key) const
+		{
+			std::shared_lock lock(mutex);
+
+			auto iterator = map.find(key);
+
+			return iterator == map.end() ? 0 : iterator->second;
+		}
+
+	private:
+
+		std::unordered_map<uint64_t, uint64_t> map;
+		mutable Mutex mutex;
+
+	};
+
+	class ExclusiveMutex
+	{
+
+	public:
+
+		void lock() { mutex.lock(); }
+		void unlock() { mutex.unlock(); }
+		void lock_shared() { mutex.lock(); }
+		void unlock_shared() { mutex.unlock(); }
+
+	private:
+
+		std::mutex mutex;
+
+	};
+
+	template <typename C>
+	void Insert(C& map, uint64_t key, uint64_t value)
+	{
+		if constexpr (requires { map.Insert(key, value); })
+			map.Insert(key, value);
+		else
+			map |= std::pair<uint64_t, uint64_t>{ key, value };
+	}
+
+	template <typename C>
+	uint64_t Find(const C& map, uint64_t key)
+	{
+		if constexpr (requires { map.Find(key); })
+			return map.Find(key);
+		else
+			return map.TryGet(key).value_or(0);
+	}
+
+	uint64_t Next(uint64_t& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		return state;
+	}
+
+	template <typename C>
+	void ContentionBenchmarks(std::string_view backend)
+	{
+		for (const Workload& workload : Workloads)
+		{
+			std::string group = "ConcurrentMap." + std::string(workload.name);
+
+			if (!Benchmark::IsEnabled(group, backend))
+				continue;
+
+			for (size_t threads : ThreadCounts)
+			{
+				C map;
+
+				for (uint64_t key = 0; key < workload.keyCount; ++key)
+					Insert(map, key, key);
+
+				auto function = [&](size_t thread, size_t operations)
+				{
+					uint64_t state = 0x9E3779B97F4A7C15ull * (thread + 1);
+					uint64_t sum = 0;
+
+					for (size_t i = 0; i < operations; ++i)
+					{
+						uint64_t random = Next(state);
+						uint64_t key = (random >> 8) % workload.keyCount;
+
+						if ((random & 0xFF) % 100 < workload.writePercent)
+							Insert(map, key, random);
+						else
+							sum += Find(map, key);
+					}
+
+					DoNotOptimize(sum);
+				};
+
+				Benchmark::Report(group, backend, threads, Benchmark::Measure(threads, 1 << 18, function));
+			}
+		}
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	ContentionBenchmarks<ConcurrentMap<uint64_t, uint64_t>>("ConcurrentMap");
+	ContentionBenchmarks<Types::BasicConcurrentMap<uint64_t, uint64_t, 1>>("ConcurrentMap shards=1");
+	ContentionBenchmarks<LockedUnorderedMap<std::shared_mutex>>("unordered_map+shared_mutex");
+	ContentionBenchmarks<LockedUnorderedMap<ExclusiveMutex>>("unordered_map+mutex");
+}
\ No newline at end of file
@@ -0,0 +1,451 @@
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <version>
+
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+
+#include "Benchmark.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Util;
+
+namespace
+{
+	constexpr size_t ElementCount = 1024;
+	constexpr size_t SmallCount = 64;
+
+	constexpr std::string_view LongText = "Assets/Invasion/Shader/DefaultVertex.hlsl#main";
+
+	template <typename T>
+	size_t HashCombine(size_t seed, const T& value)
+	{
+		return seed ^ (std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+	}
+
+	template <typename C>
+	void Push(C& container, int value)
+	{
+		if constexpr (requires { container.push_back(value); })
+			container.push_back(value);
+		else
+			container += value;
+	}
+
+	template <typename C>
+	void Insert(C& container, int key, int value)
+	{
+		if constexpr (requires { container.emplace(key, value); })
+			container.emplace(key, value);
+		else
+			container |= std::pair<int, int>{ key, value };
+	}
+
+	template <typename T>
+	size_t ValueOf(const T& element)
+	{
+		if constexpr (requires { element.second; })
+			return static_cast<size_t>(element.second);
+		else
+			return static_cast<size_t>(element);
+	}
+
+	template <typename C>
+	size_t Accumulate(const C& container)
+	{
+		size_t sum = 0;
+
+		for (auto iterator = container.cbegin(), end = container.cend(); iterator != end; ++iterator)
+			sum += ValueOf(*iterator);
+
+		return sum;
+	}
+
+	template <typename C>
+	size_t Find(const C& container, int key)
+	{
+		if constexpr (requires { container.at(key); })
+			return static_cast<size_t>(container.at(key));
+		else
+			return static_cast<size_t>(container[key]);
+	}
+
+	template <typename C>
+	C Copy(const C& container)
+	{
+		if constexpr (std::is_copy_constructible_v<C>)
+			return container;
+		else
+		{
+			C result;
+
+			result += container;
+
+			return result;
+		}
+	}
+
+	template <typename C>
+	C MakeArray(size_t count)
+	{
+		C result;
+
+		for (size_t i = 0; i < count; ++i)
+			Push(result, static_cast<int>(i));
+
+		return result;
+	}
+
+	template <typename C>
+	C MakeMap(size_t count)
+	{
+		C result;
+
+		for (size_t i = 0; i < count; ++i)
+			Insert(result, static_cast<int>(i), static_cast<int>(i * 3));
+
+		return result;
+	}
+
+	template <typename C>
+	size_t HashOf(const C& container)
+	{
+		if constexpr (requires { std::hash<C>{}(container); })
+			return std::hash<C>{}(container);
+		else
+		{
+			size_t result = 0;
+
+			for (const auto& element : container)
+				result = HashCombine(result, element);
+
+			return result;
+		}
+	}
+
+	template <typename C>
+	void ArrayBenchmarks(std::string_view name)
+	{
+		const C shared = MakeArray<C>(ElementCount);
+
+		Benchmark::Run("BasicArray.push", name, 1 << 20, [](size_t, size_t operations)
+		{
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				C array;
+
+				for (size_t i = 0; i < ElementCount; ++i)
+					Push(array, static_cast<int>(i));
+
+				DoNotOptimize(array);
+			}
+		});
+
+		Benchmark::Run("BasicArray.index", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t i = 0; i < operations; ++i)
+				sum += static_cast<size_t>(shared[i & (ElementCount - 1)]);
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("BasicArray.iterate", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+				sum += Accumulate(shared);
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("BasicArray.copy", name, 1 << 18, [](size_t, size_t operations)
+		{
+			const C source = MakeArray<C>(SmallCount);
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C copy = source;
+
+				DoNotOptimize(copy);
+			}
+		});
+
+		Benchmark::Run("BasicArray.move", name, 1 << 20, [](size_t, size_t operations)
+		{
+			C source = MakeArray<C>(SmallCount);
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C moved = std::move(source);
+
+				source = std::move(moved);
+
+				DoNotOptimize(source);
+			}
+		});
+
+		Benchmark::Run("BasicArray.hash", name, 1 << 12, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+				DoNotOptimize(HashOf(shared));
+		});
+
+#ifdef __cpp_lib_format
+		Benchmark::Run("BasicArray.format", name, 1 << 10, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				if constexpr (requires { std::format("{}", shared); })
+					DoNotOptimize(std::format("{}", shared));
+				else
+				{
+					std::string result = "{";
+
+					for (size_t j = 0; j < shared.size(); ++j)
+						std::format_to(std::back_inserter(result), j + 1 < shared.size() ? "{}, " : "{}", shared[j]);
+
+					result += "}";
+
+					DoNotOptimize(result);
+				}
+			}
+		});
+#endif
+	}
+
+	template <typename C>
+	void MapBenchmarks(std::string_view name)
+	{
+		const C shared = MakeMap<C>(ElementCount);
+
+		Benchmark::Run("BasicMap.push", name, 1 << 18, [](size_t, size_t operations)
+		{
+			for (size_t done = 0; done < operations; done += ElementCount)
+				DoNotOptimize(MakeMap<C>(ElementCount));
+		});
+
+		Benchmark::Run("BasicMap.index", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t i = 0; i < operations; ++i)
+				sum += Find(shared, static_cast<int>((i * 7) & (ElementCount - 1)));
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("BasicMap.iterate", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+				sum += Accumulate(shared);
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("BasicMap.copy", name, 1 << 14, [](size_t, size_t operations)
+		{
+			const C source = MakeMap<C>(SmallCount);
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C copy = Copy(source);
+
+				DoNotOptimize(copy);
+			}
+		});
+
+		Benchmark::Run("BasicMap.move", name, 1 << 20, [](size_t, size_t operations)
+		{
+			C source = MakeMap<C>(SmallCount);
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C moved = std::move(source);
+
+				source = std::move(moved);
+
+				DoNotOptimize(source);
+			}
+		});
+	}
+
+	template <typename C>
+	void StringBenchmarks(std::string_view name)
+	{
+		const C shared = C(std::string(LongText));
+
+		Benchmark::Run("BasicString.push", name, 1 << 20, [](size_t, size_t operations)
+		{
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				C string;
+
+				for (size_t i = 0; i < ElementCount; ++i)
+					string += static_cast<char>('a' + (i & 15));
+
+				DoNotOptimize(string);
+			}
+		});
+
+		Benchmark::Run("BasicString.index", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t i = 0; i < operations; ++i)
+				sum += static_cast<size_t>(shared[i % LongText.size()]);
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("BasicString.iterate", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += LongText.size())
+				sum += Accumulate(shared);
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("BasicString.copy", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C copy = shared;
+
+				DoNotOptimize(copy);
+			}
+		});
+
+		Benchmark::Run("BasicString.move", name, 1 << 20, [](size_t, size_t operations)
+		{
+			C source = C(std::string(LongText));
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C moved = std::move(source);
+
+				source = std::move(moved);
+
+				DoNotOptimize(source);
+			}
+		});
+
+		Benchmark::Run("BasicString.hash", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+				DoNotOptimize(std::hash<C>{}(shared));
+		});
+
+#ifdef __cpp_lib_format
+		Benchmark::Run("BasicString.format", name, 1 << 18, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+				DoNotOptimize(std::format("{}:{}", shared, i));
+		});
+#endif
+	}
+
+	template <template <typename...> class TupleType, auto GetFunction>
+	void TupleBenchmarks(std::string_view name)
+	{
+		using C = TupleType<int, double, std::string>;
+
+		const C shared = C(7, 0.5, std::string(LongText));
+
+		Benchmark::Run("BasicTuple.push", name, 1 << 20, [](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C tuple(static_cast<int>(i), 0.5, std::string("short"));
+
+				DoNotOptimize(tuple);
+			}
+		});
+
+		Benchmark::Run("BasicTuple.index", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			C tuple = shared;
+			size_t sum = 0;
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				DoNotOptimize(tuple);
+
+				sum += static_cast<size_t>(GetFunction.template operator()<0>(tuple)) + GetFunction.template operator()<2>(tuple).size();
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("BasicTuple.copy", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C copy = shared;
+
+				DoNotOptimize(copy);
+			}
+		});
+
+		Benchmark::Run("BasicTuple.move", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			C source = shared;
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				C moved = std::move(source);
+
+				source = std::move(moved);
+
+				DoNotOptimize(source);
+			}
+		});
+
+		Benchmark::Run("BasicTuple.hash", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				if constexpr (requires { std::hash<C>{}(shared); })
+					DoNotOptimize(std::hash<C>{}(shared));
+				else
+					DoNotOptimize(HashCombine(HashCombine(HashCombine(0, std::get<0>(shared)), std::get<1>(shared)), std::get<2>(shared)));
+			}
+		});
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	ArrayBenchmarks<std::vector<int>>("std::vector");
+	ArrayBenchmarks<LocalArray<int>>("LocalArray");
+	ArrayBenchmarks<MutableArray<int>>("MutableArray");
+	ArrayBenchmarks<SpinArray<int>>("SpinArray");
+
+	MapBenchmarks<std::map<int, int>>("std::map");
+	MapBenchmarks<std::unordered_map<int, int>>("std::unordered_map");
+	MapBenchmarks<OrderedMap<int, int>>("OrderedMap");
+	MapBenchmarks<UnorderedMap<int, int>>("UnorderedMap");
+	MapBenchmarks<FlatMap<int, int>>("FlatMap");
+
+	StringBenchmarks<std::string>("std::string");
+	StringBenchmarks<NarrowString>("NarrowString");
+	StringBenchmarks<SynchronizedNarrowString>("SynchronizedNarrowString");
+
+	TupleBenchmarks<std::tuple, []<size_t I>(const auto& tuple) -> const auto& { return std::get<I>(tuple); }>("std::tuple");
+	TupleBenchmarks<Tuple, []<size_t I>(const auto& tuple) -> const auto& { return tuple.template Get<I>(); }>("Tuple");
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Util;
+
+namespace
+{
+	constexpr size_t EntryCounts[] = { 10, 1000, 1000000 };
+
+	uint64_t Mix(uint64_t value)
+	{
+		value += 0x9E3779B97F4A7C15ull;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+
+		return value ^ (value >> 31);
+	}
+
+	template <typename Key>
+	Key MakeKey(uint64_t index)
+	{
+		if constexpr (std::is_same_v<Key, std::string>)
+			return "Entity/" + std::to_string(Mix(index));
+		else
+			return static_cast<Key>(Mix(index));
+	}
+
+	template <typename Key>
+	std::vector<Key> MakeKeys(size_t count, uint64_t offset)
+	{
+		std::vector<Key> keys;
+
+		keys.reserve(count);
+
+		for (size_t i = 0; i < count; ++i)
+			keys.push_back(MakeKey<Key>(offset + i));
+
+		return keys;
+	}
+
+	template <typename C, typename Key>
+	void Insert(C& map, const Key& key, uint64_t value)
+	{
+		if constexpr (requires { map.try_emplace(key, value); })
+			map.try_emplace(key, value);
+		else
+			map |= std::pair<Key, uint64_t>{ key, value };
+	}
+
+	template <typename C, typename Key>
+	bool Contains(const C& map, const Key& key)
+	{
+		if constexpr (requires { map.Contains(key); })
+			return map.Contains(key);
+		else
+			return map.find(key) != map.end();
+	}
+
+	template <typename C, typename Key>
+	uint64_t Lookup(const C& map, const Key& key)
+	{
+		if constexpr (requires { map.at(key); })
+			return map.at(key);
+		else
+			return map[key];
+	}
+
+	template <typename C>
+	uint64_t Accumulate(const C& map)
+	{
+		uint64_t sum = 0;
+
+		for (auto iterator = map.cbegin(), end = map.cend(); iterator != end; ++iterator)
+			sum += (*iterator).second;
+
+		return sum;
+	}
+
+	template <typename C, typename Key>
+	C MakeMap(const std::vector<Key>& keys)
+	{
+		C map;
+
+		for (size_t i = 0; i < keys.size(); ++i)
+			Insert(map, keys[i], i);
+
+		return map;
+	}
+
+	template <typename C, typename Key>
+	void MapBenchmarks(std::string_view group, std::string_view backend)
+	{
+		for (size_t count : EntryCounts)
+		{
+			std::string name = std::string(backend) + " n=" + std::to_string(count);
+
+			if (!Benchmark::IsEnabled(group, name))
+				continue;
+
+			const std::vector<Key> keys = MakeKeys<Key>(count, 0);
+			const std::vector<Key> missing = MakeKeys<Key>(std::min<size_t>(count, 4096), count);
+			const C shared = MakeMap<C>(keys);
+
+			size_t operations = std::max<size_t>(count, 1 << 20);
+
+			Benchmark::Run(std::string(group) + ".insert", name, operations, [&](size_t, size_t total)
+			{
+				for (size_t done = 0; done < total; done += keys.size())
+					DoNotOptimize(MakeMap<C>(keys));
+			});
+
+			Benchmark::Run(std::string(group) + ".find-hit", name, operations, [&](size_t thread, size_t total)
+			{
+				uint64_t sum = 0;
+
+				for (size_t i = 0; i < total; ++i)
+					sum += Lookup(shared, keys[(i * 7919 + thread) % keys.size()]);
+
+				DoNotOptimize(sum);
+			});
+
+			Benchmark::Run(std::string(group) + ".find-miss", name, operations, [&](size_t thread, size_t total)
+			{
+				size_t found = 0;
+
+				for (size_t i = 0; i < total; ++i)
+					found += Contains(shared, missing[(i + thread) % missing.size()]) ? 1 : 0;
+
+				DoNotOptimize(found);
+			});
+
+			Benchmark::Run(std::string(group) + ".iterate", name, operations, [&](size_t, size_t total)
+			{
+				uint64_t sum = 0;
+
+				for (size_t done = 0; done < total; done += keys.size())
+					sum += Accumulate(shared);
+
+				DoNotOptimize(sum);
+			});
+		}
+	}
+
+	template <typename Key>
+	void KeyBenchmarks(std::string_view group)
+	{
+		MapBenchmarks<std::map<Key, uint64_t>, Key>(group, "std::map");
+		MapBenchmarks<std::unordered_map<Key, uint64_t>, Key>(group, "std::unordered_map");
+		MapBenchmarks<Types::FlatHashMap<Key, uint64_t>, Key>(group, "FlatHashMap");
+		MapBenchmarks<OrderedMap<Key, uint64_t>, Key>(group, "OrderedMap");
+		MapBenchmarks<UnorderedMap<Key, uint64_t>, Key>(group, "UnorderedMap");
+		MapBenchmarks<FlatMap<Key, uint64_t>, Key>(group, "FlatMap");
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	KeyBenchmarks<uint64_t>("FlatMap.u64");
+	KeyBenchmarks<std::string>("FlatMap.string");
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "Benchmark.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Util;
+
+namespace
+{
+	constexpr size_t ElementCount = 1024;
+
+	template <typename C>
+	C MakeArray()
+	{
+		C result;
+
+		result.Resize(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+			result[i] = static_cast<int>(i);
+
+		return result;
+	}
+
+	template <typename C>
+	C MakeMap()
+	{
+		C result;
+
+		for (size_t i = 0; i < ElementCount; ++i)
+			result |= std::pair<int, int>{ static_cast<int>(i), static_cast<int>(i * 3) };
+
+		return result;
+	}
+
+	template <typename C>
+	void ArrayBenchmarks(std::string_view name)
+	{
+		C shared = MakeArray<C>();
+
+		Benchmark::Run("GuardView.array.iterator", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				for (const int& element : shared)
+					sum += static_cast<size_t>(element);
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("GuardView.array.for-each", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+				std::as_const(shared).ForEach([&](const int& element) { sum += static_cast<size_t>(element); });
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("GuardView.array.read", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				for (const int& element : shared.Read())
+					sum += static_cast<size_t>(element);
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("GuardView.array.lock", name, 1 << 22, [](size_t, size_t operations)
+		{
+			C local = MakeArray<C>();
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				for (int& element : local.Lock())
+					++element;
+			}
+
+			DoNotOptimize(local);
+		});
+	}
+
+	template <typename C>
+	void MapBenchmarks(std::string_view name)
+	{
+		C shared = MakeMap<C>();
+
+		Benchmark::Run("GuardView.map.iterator", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				for (const auto& [key, value] : shared)
+					sum += static_cast<size_t>(key + value);
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("GuardView.map.for-each", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+				std::as_const(shared).ForEach([&](const int& key, const int& value) { sum += static_cast<size_t>(key + value); });
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("GuardView.map.read", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				for (const auto& [key, value] : shared.Read())
+					sum += static_cast<size_t>(key + value);
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("GuardView.map.lock", name, 1 << 20, [](size_t, size_t operations)
+		{
+			C local = MakeMap<C>();
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				for (auto& [key, value] : local.Lock())
+					++value;
+			}
+
+			DoNotOptimize(local);
+		});
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	ArrayBenchmarks<MutableArray<int>>("MutableArray");
+	ArrayBenchmarks<SpinArray<int>>("SpinArray");
+
+	MapBenchmarks<OrderedMap<int, int>>("OrderedMap");
+	MapBenchmarks<UnorderedMap<int, int>>("UnorderedMap");
+	MapBenchmarks<FlatMap<int, int>>("FlatMap");
+}
\ No newline at end of file
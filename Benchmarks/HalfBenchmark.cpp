@@ -0,0 +1,174 @@
+#include <cmath>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "Math/Half.hpp"
+#include "Math/Normalized.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Math;
+
+namespace
+{
+	constexpr size_t ElementCount = 4096;
+
+#if INVASION_MATH_F16C
+	constexpr std::string_view Path = "F16C";
+#elif INVASION_MATH_SSE
+	constexpr std::string_view Path = "SSE";
+#else
+	constexpr std::string_view Path = "scalar";
+#endif
+
+	template <typename Function>
+	void RunPasses(std::string_view group, std::string_view name, Function&& pass)
+	{
+		Benchmark::Run(group, name, 1 << 24, [&](size_t, size_t operations)
+		{
+			for (size_t done = 0; done < operations; done += ElementCount)
+				pass();
+		});
+	}
+
+	void HalfBenchmarks()
+	{
+		std::vector<float> floats(ElementCount);
+		std::vector<Half> halves(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+			floats[i] = std::sin(static_cast<float>(i)) * 1000.0f;
+
+		RunPasses("Half.to-half", Path, [&]()
+		{
+			Half::Convert(floats.data(), halves.data(), ElementCount);
+
+			DoNotOptimize(halves.data());
+		});
+
+		RunPasses("Half.to-half", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				halves[i] = Half(floats[i]);
+
+			DoNotOptimize(halves.data());
+		});
+
+		RunPasses("Half.to-float", Path, [&]()
+		{
+			Half::Convert(halves.data(), floats.data(), ElementCount);
+
+			DoNotOptimize(floats.data());
+		});
+
+		RunPasses("Half.to-float", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				floats[i] = halves[i];
+
+			DoNotOptimize(floats.data());
+		});
+	}
+
+	void NormalizedBenchmarks()
+	{
+		std::vector<Vector<float, 2>> pairs(ElementCount);
+		std::vector<Vector<float, 4>> colors(ElementCount);
+		std::vector<Vector<float, 3>> normals(ElementCount);
+		std::vector<SNorm16x2> snorms(ElementCount);
+		std::vector<UNorm8x4> unorms(ElementCount);
+		std::vector<OctahedralNormal> octahedrals(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+		{
+			float angle = static_cast<float>(i) * 0.01f;
+
+			pairs[i] = { std::sin(angle), std::cos(angle) };
+			colors[i] = { std::abs(std::sin(angle)), std::abs(std::cos(angle)), 0.5f, 1.0f };
+			normals[i] = Vector<float, 3>{ std::sin(angle), std::cos(angle * 0.7f), std::sin(angle * 1.3f) }.Normalize();
+		}
+
+		RunPasses("SNorm16x2.encode", Path, [&]()
+		{
+			SNorm16x2::Convert(pairs.data(), snorms.data(), ElementCount);
+
+			DoNotOptimize(snorms.data());
+		});
+
+		RunPasses("SNorm16x2.encode", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				snorms[i] = SNorm16x2(pairs[i]);
+
+			DoNotOptimize(snorms.data());
+		});
+
+		RunPasses("SNorm16x2.decode", Path, [&]()
+		{
+			SNorm16x2::Convert(snorms.data(), pairs.data(), ElementCount);
+
+			DoNotOptimize(pairs.data());
+		});
+
+		RunPasses("SNorm16x2.decode", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				pairs[i] = snorms[i].ToVector();
+
+			DoNotOptimize(pairs.data());
+		});
+
+		RunPasses("UNorm8x4.encode", Path, [&]()
+		{
+			UNorm8x4::Convert(colors.data(), unorms.data(), ElementCount);
+
+			DoNotOptimize(unorms.data());
+		});
+
+		RunPasses("UNorm8x4.encode", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				unorms[i] = UNorm8x4(colors[i]);
+
+			DoNotOptimize(unorms.data());
+		});
+
+		RunPasses("UNorm8x4.decode", Path, [&]()
+		{
+			UNorm8x4::Convert(unorms.data(), colors.data(), ElementCount);
+
+			DoNotOptimize(colors.data());
+		});
+
+		RunPasses("UNorm8x4.decode", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				colors[i] = unorms[i].ToVector();
+
+			DoNotOptimize(colors.data());
+		});
+
+		RunPasses("OctahedralNormal.encode", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				octahedrals[i] = OctahedralNormal(normals[i]);
+
+			DoNotOptimize(octahedrals.data());
+		});
+
+		RunPasses("OctahedralNormal.decode", "scalar loop", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+				normals[i] = octahedrals[i].ToVector();
+
+			DoNotOptimize(normals.data());
+		});
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	HalfBenchmarks();
+	NormalizedBenchmarks();
+}
\ No newline at end of file
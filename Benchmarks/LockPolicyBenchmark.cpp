@@ -0,0 +1,100 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Util;
+
+namespace
+{
+	constexpr size_t ElementCount = 1024;
+
+	template <typename C>
+	C MakeArray()
+	{
+		C result;
+
+		if constexpr (requires { result.resize(ElementCount); })
+			result.resize(ElementCount);
+		else
+			result.Resize(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+			result[i] = static_cast<int>(i);
+
+		return result;
+	}
+
+	template <typename C>
+	void PolicyBenchmarks(std::string_view name)
+	{
+		const C shared = MakeArray<C>();
+
+		Benchmark::Run("LockPolicy.read", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t i = 0; i < operations; ++i)
+				sum += static_cast<size_t>(shared[i & (ElementCount - 1)]);
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("LockPolicy.write", name, 1 << 22, [](size_t, size_t operations)
+		{
+			C local = MakeArray<C>();
+
+			for (size_t i = 0; i < operations; ++i)
+				local[i & (ElementCount - 1)] += 1;
+
+			DoNotOptimize(local);
+		});
+
+		Benchmark::Run("LockPolicy.length", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			const C* array = &shared;
+			size_t sum = 0;
+
+			for (size_t i = 0; i < operations; ++i)
+			{
+				DoNotOptimize(array);
+
+				if constexpr (requires { array->size(); })
+					sum += array->size();
+				else
+					sum += array->Length();
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("LockPolicy.for-each", name, 1 << 22, [&](size_t, size_t operations)
+		{
+			size_t sum = 0;
+
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				if constexpr (requires { shared.Read(); })
+					shared.ForEach([&](const int& element) { sum += static_cast<size_t>(element); });
+				else
+				{
+					for (const int& element : shared)
+						sum += static_cast<size_t>(element);
+				}
+			}
+
+			DoNotOptimize(sum);
+		});
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	PolicyBenchmarks<std::vector<int>>("std::vector");
+	PolicyBenchmarks<LocalArray<int>>("NoLock (LocalArray)");
+	PolicyBenchmarks<MutableArray<int>>("SharedMutexLock (MutableArray)");
+	PolicyBenchmarks<SpinArray<int>>("SpinLock (SpinArray)");
+}
\ No newline at end of file
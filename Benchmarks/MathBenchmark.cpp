@@ -0,0 +1,391 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "Math/Transform.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Math;
+
+namespace
+{
+	constexpr size_t ElementCount = 1024;
+	constexpr size_t SampleCount = 1 << 16;
+	constexpr size_t ChainDepths[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+	using Float3 = Vector<float, 3>;
+	using Double3 = Vector<double, 3>;
+	using Float4x4 = Matrix<float, 4, 4>;
+	using Double4x4 = Matrix<double, 4, 4>;
+
+	class Random
+	{
+
+	public:
+
+		explicit Random(uint64_t seed) : state(seed) { }
+
+		float Next(float minimum, float maximum)
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+
+			return minimum + (maximum - minimum) * static_cast<float>(state >> 40) / static_cast<float>(1 << 24);
+		}
+
+		Float3 NextVector(float minimum, float maximum)
+		{
+			float x = Next(minimum, maximum);
+			float y = Next(minimum, maximum);
+			float z = Next(minimum, maximum);
+
+			return { x, y, z };
+		}
+
+		Float4x4 NextMatrix()
+		{
+			Float4x4 result;
+
+			for (size_t row = 0; row < 4; ++row)
+			{
+				for (size_t column = 0; column < 4; ++column)
+					result(row, column) = Next(-4.0f, 4.0f);
+			}
+
+			return result;
+		}
+
+	private:
+
+		uint64_t state;
+
+	};
+
+	class Accuracy
+	{
+
+	public:
+
+		void Add(float actual, double expected)
+		{
+			maximumUlp = std::max(maximumUlp, UlpDistance(actual, static_cast<float>(expected)));
+			maximumError = std::max(maximumError, std::abs(static_cast<double>(actual) - expected));
+			maximumMagnitude = std::max(maximumMagnitude, std::abs(expected));
+		}
+
+		void Add(const Float3& actual, const Double3& expected)
+		{
+			for (size_t i = 0; i < 3; ++i)
+				Add(actual[i], expected[i]);
+		}
+
+		void Add(const Float4x4& actual, const Double4x4& expected)
+		{
+			for (size_t row = 0; row < 4; ++row)
+			{
+				for (size_t column = 0; column < 4; ++column)
+					Add(actual(row, column), expected(row, column));
+			}
+		}
+
+		void Report(std::string_view name) const
+		{
+			std::printf("%-28s %-30.*s %12llu %12.3e\n", "Math.accuracy", static_cast<int>(name.size()), name.data(), static_cast<unsigned long long>(maximumUlp), maximumMagnitude > 0.0 ? maximumError / maximumMagnitude : maximumError);
+		}
+
+	private:
+
+		static int64_t Ordered(float value)
+		{
+			int32_t bits;
+
+			std::memcpy(&bits, &value, sizeof(bits));
+
+			return bits < 0 ? static_cast<int64_t>(INT32_MIN) - bits : bits;
+		}
+
+		static uint64_t UlpDistance(float a, float b)
+		{
+			int64_t difference = Ordered(a) - Ordered(b);
+
+			return static_cast<uint64_t>(difference < 0 ? -difference : difference);
+		}
+
+		uint64_t maximumUlp = 0;
+		double maximumError = 0.0;
+		double maximumMagnitude = 0.0;
+
+	};
+
+	Double3 ToDouble(const Float3& value)
+	{
+		return { value[0], value[1], value[2] };
+	}
+
+	Double4x4 ToDouble(const Float4x4& value)
+	{
+		Double4x4 result;
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+				result(row, column) = value(row, column);
+		}
+
+		return result;
+	}
+
+	Double4x4 Multiply(const Double4x4& a, const Double4x4& b)
+	{
+		Double4x4 result = Double4x4::Zero();
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+			{
+				for (size_t k = 0; k < 4; ++k)
+					result(row, column) += a(row, k) * b(k, column);
+			}
+		}
+
+		return result;
+	}
+
+	void AccuracyBenchmarks()
+	{
+		std::printf("%-28s %-30s %12s %12s\n", "group", "benchmark", "max ulp", "max rel err");
+
+		Random random(0x5DEECE66Dull);
+		Accuracy add, dot, cross, normalize, multiply, lookAt, projection, euler;
+
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			Float3 a = random.NextVector(-100.0f, 100.0f);
+			Float3 b = random.NextVector(-100.0f, 100.0f);
+
+			add.Add(a + b, ToDouble(a) + ToDouble(b));
+			dot.Add(Float3::Dot(a, b), Double3::Dot(ToDouble(a), ToDouble(b)));
+			cross.Add(Float3::Cross(a, b), Double3::Cross(ToDouble(a), ToDouble(b)));
+			normalize.Add(a.Normalize(), ToDouble(a).Normalize());
+
+			Float4x4 left = random.NextMatrix();
+			Float4x4 right = random.NextMatrix();
+
+			multiply.Add(left * right, Multiply(ToDouble(left), ToDouble(right)));
+
+			Float3 eye = random.NextVector(-50.0f, 50.0f);
+			Float3 target = eye + random.NextVector(1.0f, 10.0f);
+
+			lookAt.Add(Float4x4::LookAt(eye, target, { 0.0f, 1.0f, 0.0f }), Double4x4::LookAt(ToDouble(eye), ToDouble(target), { 0.0, 1.0, 0.0 }));
+
+			float fov = random.Next(0.5f, 2.0f);
+			float aspect = random.Next(0.5f, 2.5f);
+
+			projection.Add(Float4x4::Projection(fov, aspect, 0.1f, 1000.0f), Double4x4::Projection(fov, aspect, 0.1, 1000.0));
+
+			Float3 angles = random.NextVector(-180.0f, 180.0f);
+
+			euler.Add(Float4x4::EulerRotation(angles), Double4x4::EulerRotation(ToDouble(angles)));
+		}
+
+		add.Report("Vector add");
+		dot.Report("Vector dot");
+		cross.Report("Vector cross");
+		normalize.Report("Vector normalize");
+		multiply.Report("Matrix multiply");
+		lookAt.Report("LookAt");
+		projection.Report("Projection");
+		euler.Report("EulerRotation");
+		std::printf("\n");
+	}
+
+	void VectorBenchmarks()
+	{
+		Random random(1);
+		std::vector<Float3> a(ElementCount), b(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+		{
+			a[i] = random.NextVector(-100.0f, 100.0f);
+			b[i] = random.NextVector(-100.0f, 100.0f);
+		}
+
+		Benchmark::Run("Math.vector", "add", 1 << 22, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				Float3 value = a[i & (ElementCount - 1)] + b[i & (ElementCount - 1)];
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Math.vector", "multiply-add", 1 << 22, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				Float3 value = a[i & (ElementCount - 1)] * 0.5f + b[i & (ElementCount - 1)];
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Math.vector", "dot", 1 << 22, [&](size_t, size_t operations)
+		{
+			float sum = 0.0f;
+
+			for (size_t i = 0; i < operations; ++i)
+				sum += Float3::Dot(a[i & (ElementCount - 1)], b[i & (ElementCount - 1)]);
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("Math.vector", "cross", 1 << 22, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				Float3 value = Float3::Cross(a[i & (ElementCount - 1)], b[i & (ElementCount - 1)]);
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Math.vector", "normalize", 1 << 22, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				Float3 value = a[i & (ElementCount - 1)].Normalize();
+
+				DoNotOptimize(value);
+			}
+		});
+	}
+
+	void MatrixBenchmarks()
+	{
+		Random random(2);
+		std::vector<Float4x4> matrices(ElementCount);
+		std::vector<Float3> points(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+		{
+			matrices[i] = random.NextMatrix();
+			points[i] = random.NextVector(-100.0f, 100.0f);
+		}
+
+		Benchmark::Run("Math.matrix", "multiply", 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				Float4x4 value = matrices[i & (ElementCount - 1)] * matrices[(i + 1) & (ElementCount - 1)];
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Math.matrix", "LookAt", 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				const Float3& eye = points[i & (ElementCount - 1)];
+				Float4x4 value = Float4x4::LookAt(eye, eye + Float3{ 1.0f, 2.0f, 3.0f }, { 0.0f, 1.0f, 0.0f });
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Math.matrix", "Projection", 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				float fov = 0.5f + static_cast<float>(i & (ElementCount - 1)) / ElementCount;
+				Float4x4 value = Float4x4::Projection(fov, 16.0f / 9.0f, 0.1f, 1000.0f);
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Math.matrix", "EulerRotation", 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				Float4x4 value = Float4x4::EulerRotation(points[i & (ElementCount - 1)]);
+
+				DoNotOptimize(value);
+			}
+		});
+	}
+
+	void TransformBenchmarks()
+	{
+		for (size_t depth : ChainDepths)
+		{
+			std::string name = "depth=" + std::to_string(depth);
+
+			if (!Benchmark::IsEnabled("Math.transform", name))
+				continue;
+
+			std::vector<Shared<Transform>> chain;
+
+			for (size_t i = 0; i < depth; ++i)
+			{
+				chain.push_back(Transform::Create());
+
+				if (i > 0)
+					chain[i]->SetParent(chain[i - 1]);
+
+				chain[i]->SetLocalPosition({ 1.0f, 0.0f, 0.0f });
+				chain[i]->SetLocalRotation({ 0.0f, 5.0f, 0.0f });
+			}
+
+			auto lazy = [&](size_t, size_t operations)
+			{
+				for (size_t done = 0; done < operations; done += depth)
+				{
+					chain.front()->Translate({ 0.001f, 0.0f, 0.0f });
+
+					Float4x4 value = chain.back()->GetModelMatrix();
+
+					DoNotOptimize(value);
+				}
+			};
+
+			auto eager = [&](size_t, size_t operations)
+			{
+				for (size_t done = 0; done < operations; done += depth)
+				{
+					chain.front()->Translate({ 0.001f, 0.0f, 0.0f });
+
+					TransformHierarchy::GetInstance().Update();
+				}
+
+				Float4x4 value = chain.back()->GetModelMatrix();
+
+				DoNotOptimize(value);
+			};
+
+			Benchmark::Report("Math.transform.lazy", name, 1, Benchmark::Measure(1, 1 << 18, lazy));
+			Benchmark::Report("Math.transform.update", name, 1, Benchmark::Measure(1, 1 << 18, eager));
+		}
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	VectorBenchmarks();
+	MatrixBenchmarks();
+	TransformBenchmarks();
+
+	std::printf("\n");
+
+	AccuracyBenchmarks();
+}
\ No newline at end of file
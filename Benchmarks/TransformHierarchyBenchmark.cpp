@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "Math/TransformHierarchy.hpp"
+#include "Util/Threading/ThreadPool.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Math;
+using namespace Invasion::Util::Threading;
+
+namespace
+{
+	constexpr size_t FrameCount = 64;
+	constexpr size_t ThreadCounts[] = { 1, 2, 4, 8, 16, 32 };
+	constexpr size_t MutationCounts[] = { 1, 4, 16, 64 };
+
+	TransformHierarchy& Hierarchy()
+	{
+		return TransformHierarchy::GetInstance();
+	}
+
+	class Scene
+	{
+
+	public:
+
+		Scene(const Scene&) = delete;
+		Scene& operator=(const Scene&) = delete;
+
+		~Scene()
+		{
+			for (size_t i = nodes.size(); i > 0; --i)
+				Hierarchy().Release(nodes[i - 1]);
+		}
+
+		const std::vector<uint32_t>& GetNodes() const
+		{
+			return nodes;
+		}
+
+		const std::vector<uint32_t>& GetRoots() const
+		{
+			return roots;
+		}
+
+		const std::vector<uint32_t>& GetLeaves() const
+		{
+			return leaves;
+		}
+
+		static Scene Wide(size_t branches, size_t leavesPerBranch)
+		{
+			Scene scene;
+
+			uint32_t root = scene.Add(TransformHierarchy::Invalid);
+
+			for (size_t i = 0; i < branches; ++i)
+			{
+				uint32_t branch = scene.Add(root);
+
+				for (size_t j = 0; j < leavesPerBranch; ++j)
+					scene.leaves.push_back(scene.Add(branch));
+			}
+
+			scene.roots.push_back(root);
+
+			return scene;
+		}
+
+		static Scene Deep(size_t chains, size_t depth)
+		{
+			Scene scene;
+
+			for (size_t i = 0; i < chains; ++i)
+			{
+				uint32_t node = scene.Add(TransformHierarchy::Invalid);
+
+				scene.roots.push_back(node);
+
+				for (size_t j = 1; j < depth; ++j)
+					node = scene.Add(node);
+
+				scene.leaves.push_back(node);
+			}
+
+			return scene;
+		}
+
+	private:
+
+		Scene() = default;
+
+		Scene(Scene&&) = default;
+
+		uint32_t Add(uint32_t parent)
+		{
+			uint32_t node = Hierarchy().Allocate();
+
+			if (parent != TransformHierarchy::Invalid)
+				Hierarchy().SetParent(node, parent);
+
+			Hierarchy().SetLocalPosition(node, { 0.5f, 0.25f, 0.0f });
+			Hierarchy().SetLocalRotation(node, { 0.0f, 3.0f, 0.0f });
+
+			nodes.push_back(node);
+
+			return node;
+		}
+
+		std::vector<uint32_t> nodes;
+		std::vector<uint32_t> roots;
+		std::vector<uint32_t> leaves;
+
+	};
+
+	Result PerNode(Result result, size_t nodes)
+	{
+		result.nanosecondsPerOperation /= static_cast<double>(nodes);
+		result.operationsPerSecond *= static_cast<double>(nodes);
+		result.allocationsPerOperation /= static_cast<double>(nodes);
+		result.bytesPerOperation /= static_cast<double>(nodes);
+
+		return result;
+	}
+
+	template <typename Function>
+	void RunFrames(std::string_view group, std::string_view name, size_t nodes, Function&& frame)
+	{
+		if (!Benchmark::IsEnabled(group, name))
+			return;
+
+		auto function = [&](size_t, size_t frames)
+		{
+			for (size_t i = 0; i < frames; ++i)
+				frame();
+		};
+
+		Benchmark::Report(group, name, 1, PerNode(Benchmark::Measure(1, FrameCount, function), nodes));
+	}
+
+	void LayoutBenchmarks(std::string_view shape, Scene scene)
+	{
+		auto pool = ThreadPool::Create(1);
+
+		std::string name = std::string(shape) + " n=" + std::to_string(scene.GetNodes().size()) + " per node";
+
+		Hierarchy().Update(*pool);
+
+		const size_t nodes = scene.GetNodes().size();
+
+		RunFrames("Hierarchy.roots-moved", name, nodes, [&]()
+		{
+			for (uint32_t root : scene.GetRoots())
+				Hierarchy().Translate(root, { 0.001f, 0.0f, 0.0f });
+
+			Hierarchy().Update(*pool);
+		});
+
+		RunFrames("Hierarchy.all-moved", name, nodes, [&]()
+		{
+			for (uint32_t node : scene.GetNodes())
+				Hierarchy().Translate(node, { 0.001f, 0.0f, 0.0f });
+
+			Hierarchy().Update(*pool);
+		});
+
+		RunFrames("Hierarchy.lazy-leaves", name, nodes, [&]()
+		{
+			for (uint32_t root : scene.GetRoots())
+				Hierarchy().Translate(root, { 0.001f, 0.0f, 0.0f });
+
+			for (uint32_t leaf : scene.GetLeaves())
+				DoNotOptimize(Hierarchy().GetWorldMatrix(leaf));
+		});
+	}
+
+	void MutationBenchmarks(Scene scene)
+	{
+		auto pool = ThreadPool::Create(1);
+
+		const size_t nodes = scene.GetNodes().size();
+		const uint32_t root = scene.GetRoots().front();
+		const uint32_t branch = scene.GetNodes()[1];
+
+		Hierarchy().Update(*pool);
+
+		Benchmark::Run("Hierarchy.mutate", "root of " + std::to_string(nodes), 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+				Hierarchy().Translate(root, { 0.001f, 0.0f, 0.0f });
+		});
+
+		Benchmark::Run("Hierarchy.mutate", "branch of " + std::to_string(nodes / 1000), 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+				Hierarchy().Translate(branch, { 0.001f, 0.0f, 0.0f });
+		});
+
+		Hierarchy().Update(*pool);
+
+		for (size_t mutations : MutationCounts)
+		{
+			std::string name = "root x" + std::to_string(mutations) + " per node";
+
+			RunFrames("Hierarchy.mutate-frame", name, nodes, [&]()
+			{
+				for (size_t i = 0; i < mutations; ++i)
+				{
+					Hierarchy().Translate(root, { 0.001f, 0.0f, 0.0f });
+					Hierarchy().Rotate(root, { 0.0f, 0.1f, 0.0f });
+				}
+
+				Hierarchy().Update(*pool);
+			});
+		}
+	}
+
+	void StaticBenchmarks(Scene scene)
+	{
+		auto pool = ThreadPool::Create(1);
+
+		const std::vector<uint32_t>& nodes = scene.GetNodes();
+		const std::vector<uint32_t>& leaves = scene.GetLeaves();
+
+		std::vector<Matrix<float, 4, 4>> constants(nodes.size());
+		std::vector<uint32_t> versions(nodes.size(), 0);
+
+		size_t uploads = 0;
+
+		auto pull = [&]()
+		{
+			Hierarchy().Update(*pool);
+
+			for (size_t i = 0; i < nodes.size(); ++i)
+				constants[i] = Hierarchy().GetWorldMatrix(nodes[i]);
+
+			DoNotOptimize(constants.data());
+		};
+
+		auto versioned = [&]()
+		{
+			Hierarchy().Update(*pool);
+
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				uint32_t version = Hierarchy().GetWorldVersion(nodes[i]);
+
+				if (version != versions[i])
+				{
+					constants[i] = Hierarchy().GetWorldMatrix(nodes[i]);
+					versions[i] = version;
+
+					++uploads;
+				}
+			}
+
+			DoNotOptimize(constants.data());
+		};
+
+		auto moveSome = [&](size_t frame)
+		{
+			for (size_t i = frame % 100; i < leaves.size(); i += 100)
+				Hierarchy().Translate(leaves[i], { 0.001f, 0.0f, 0.0f });
+		};
+
+		size_t frame = 0;
+
+		Hierarchy().Update(*pool);
+
+		versioned();
+
+		std::string name = "wide n=" + std::to_string(nodes.size()) + " per node";
+
+		RunFrames("Static.pull-matrices", name, nodes.size(), pull);
+		RunFrames("Static.versioned", name, nodes.size(), versioned);
+
+		RunFrames("Static.pull-1%-moving", name, nodes.size(), [&]()
+		{
+			moveSome(frame++);
+			pull();
+		});
+
+		RunFrames("Static.versioned-1%-moving", name, nodes.size(), [&]()
+		{
+			moveSome(frame++);
+			versioned();
+		});
+
+		std::vector<uint32_t> observers;
+		size_t notifications = 0;
+
+		for (size_t i = 0; i < leaves.size(); i += 100)
+			observers.push_back(Hierarchy().AddObserver(leaves[i], [&notifications]() { ++notifications; }));
+
+		name = "wide, " + std::to_string(observers.size()) + " observers, per node";
+
+		RunFrames("Static.observed", name, nodes.size(), [&]()
+		{
+			Hierarchy().Update(*pool);
+		});
+
+		RunFrames("Static.observed-1%-moving", name, nodes.size(), [&]()
+		{
+			moveSome(frame++);
+
+			Hierarchy().Update(*pool);
+		});
+
+		for (uint32_t observer : observers)
+			Hierarchy().RemoveObserver(observer);
+
+		DoNotOptimize(uploads);
+		DoNotOptimize(notifications);
+	}
+
+	std::vector<Matrix<float, 4, 4>> Snapshot(const Scene& scene, ThreadPool& pool)
+	{
+		for (uint32_t root : scene.GetRoots())
+			Hierarchy().SetLocalPosition(root, { 1.0f, 2.0f, 3.0f });
+
+		Hierarchy().Update(pool);
+
+		std::vector<Matrix<float, 4, 4>> result;
+
+		result.reserve(scene.GetNodes().size());
+
+		for (uint32_t node : scene.GetNodes())
+			result.push_back(Hierarchy().GetWorldMatrix(node));
+
+		return result;
+	}
+
+	void ScalingBenchmarks(std::string_view shape, Scene scene)
+	{
+		const size_t nodes = scene.GetNodes().size();
+
+		const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		std::vector<Matrix<float, 4, 4>> reference = Snapshot(scene, *ThreadPool::Create(1));
+
+		double serial = 0.0;
+
+		for (size_t threads : ThreadCounts)
+		{
+			std::string name = std::string(shape) + " n=" + std::to_string(nodes) + " per node";
+
+			if (!Benchmark::IsEnabled("Hierarchy.scaling", name))
+				continue;
+
+			auto pool = ThreadPool::Create(threads);
+
+			std::vector<Matrix<float, 4, 4>> snapshot = Snapshot(scene, *pool);
+
+			bool identical = std::memcmp(snapshot.data(), reference.data(), sizeof(Matrix<float, 4, 4>) * nodes) == 0;
+
+			auto function = [&](size_t, size_t frames)
+			{
+				for (size_t i = 0; i < frames; ++i)
+				{
+					for (uint32_t root : scene.GetRoots())
+						Hierarchy().Translate(root, { 0.001f, 0.0f, 0.0f });
+
+					Hierarchy().Update(*pool);
+				}
+			};
+
+			Result result = PerNode(Benchmark::Measure(1, FrameCount, function), nodes);
+
+			Benchmark::Report("Hierarchy.scaling", name, threads, result);
+
+			if (threads == 1)
+				serial = result.nanosecondsPerOperation;
+
+			if (serial > 0.0)
+			{
+				double speedup = serial / result.nanosecondsPerOperation;
+
+				std::printf("%-28s %-30s %7zu  speedup %.2fx, efficiency %.0f%%%s\n", "Hierarchy.scaling", name.c_str(), threads, speedup, 100.0 * speedup / static_cast<double>(threads), threads > hardwareThreads ? " (oversubscribed)" : "");
+			}
+
+			if (!identical)
+				std::printf("%-28s %-30s %7zu  result differs from the single-threaded update\n", "Hierarchy.scaling", name.c_str(), threads);
+		}
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	LayoutBenchmarks("wide", Scene::Wide(1000, 99));
+	LayoutBenchmarks("deep", Scene::Deep(1000, 100));
+
+	MutationBenchmarks(Scene::Wide(1000, 99));
+	StaticBenchmarks(Scene::Wide(1000, 99));
+
+	ScalingBenchmarks("wide", Scene::Wide(1000, 99));
+	ScalingBenchmarks("deep", Scene::Deep(1000, 100));
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include <cmath>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+
+using namespace Invasion::Benchmarks;
+using namespace Invasion::Math;
+
+namespace
+{
+	constexpr size_t ElementCount = 4096;
+
+#ifdef INVASION_MATH_FAST_TRIG
+	constexpr std::string_view Mode = "fast-trig";
+#else
+	constexpr std::string_view Mode = "std";
+#endif
+
+	using Float3 = Vector<float, 3>;
+	using Float4x4 = Matrix<float, 4, 4>;
+
+	template <typename Function>
+	void RunPasses(std::string_view group, Function&& pass)
+	{
+		Benchmark::Run(group, Mode, 1 << 22, [&](size_t, size_t operations)
+		{
+			for (size_t done = 0; done < operations; done += ElementCount)
+				pass();
+		});
+	}
+
+	void RotationBenchmarks()
+	{
+		std::vector<Float3> angles(ElementCount);
+		std::vector<Float3> axes(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+		{
+			float t = static_cast<float>(i);
+
+			angles[i] = { std::fmod(t * 7.3f, 360.0f) - 180.0f, std::fmod(t * 3.1f, 360.0f) - 180.0f, std::fmod(t * 1.7f, 360.0f) - 180.0f };
+			axes[i] = Float3{ std::sin(t), std::cos(t * 0.5f), 0.5f }.Normalize();
+		}
+
+		RunPasses("Trig.Matrix.EulerRotation", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+			{
+				Float4x4 value = Float4x4::EulerRotation(angles[i]);
+
+				DoNotOptimize(value);
+			}
+		});
+
+		RunPasses("Trig.Matrix.RotationX", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+			{
+				Float4x4 value = Float4x4::RotationX(angles[i][0]);
+
+				DoNotOptimize(value);
+			}
+		});
+
+		RunPasses("Trig.Quaternion.FromEuler", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+			{
+				Quaternion<float> value = Quaternion<float>::FromEuler(angles[i]);
+
+				DoNotOptimize(value);
+			}
+		});
+
+		RunPasses("Trig.Quaternion.AxisAngle", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+			{
+				Quaternion<float> value = Quaternion<float>::AxisAngle(axes[i], angles[i][1]);
+
+				DoNotOptimize(value);
+			}
+		});
+
+		RunPasses("Trig.Quaternion.ToEuler", [&]()
+		{
+			for (size_t i = 0; i < ElementCount; ++i)
+			{
+				Float3 value = Quaternion<float>::FromEuler(angles[i]).ToEuler();
+
+				DoNotOptimize(value);
+			}
+		});
+	}
+
+	void ArrayBenchmarks()
+	{
+		std::vector<float> angles(ElementCount);
+		std::vector<float> sines(ElementCount);
+		std::vector<float> cosines(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+			angles[i] = std::fmod(static_cast<float>(i) * 0.37f, 200.0f) - 100.0f;
+
+		Benchmark::Run("Trig.SinCos", "Simd::SinCos", 1 << 24, [&](size_t, size_t operations)
+		{
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				Simd::SinCos(angles.data(), sines.data(), cosines.data(), ElementCount);
+
+				DoNotOptimize(sines.data());
+				DoNotOptimize(cosines.data());
+			}
+		});
+
+		Benchmark::Run("Trig.SinCos", "std::sin+std::cos", 1 << 24, [&](size_t, size_t operations)
+		{
+			for (size_t done = 0; done < operations; done += ElementCount)
+			{
+				for (size_t i = 0; i < ElementCount; ++i)
+				{
+					sines[i] = std::sin(angles[i]);
+					cosines[i] = std::cos(angles[i]);
+				}
+
+				DoNotOptimize(sines.data());
+				DoNotOptimize(cosines.data());
+			}
+		});
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	RotationBenchmarks();
+
+#ifndef INVASION_MATH_FAST_TRIG
+	ArrayBenchmarks();
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,259 @@
+#include <array>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "Math/Vector.hpp"
+
+using namespace Invasion::Benchmarks;
+
+namespace
+{
+	constexpr size_t ElementCount = 1024;
+
+	template <size_t N>
+	struct ScalarVector
+	{
+		std::array<float, N> data{};
+
+		float& operator[](size_t index) { return data[index]; }
+		float operator[](size_t index) const { return data[index]; }
+
+		ScalarVector operator+(const ScalarVector& other) const
+		{
+			ScalarVector result;
+
+			for (size_t i = 0; i < N; ++i)
+				result.data[i] = data[i] + other.data[i];
+
+			return result;
+		}
+
+		static float Dot(const ScalarVector& a, const ScalarVector& b)
+		{
+			float result = 0.0f;
+
+			for (size_t i = 0; i < N; ++i)
+				result += a.data[i] * b.data[i];
+
+			return result;
+		}
+
+		static ScalarVector Cross(const ScalarVector& a, const ScalarVector& b) requires (N == 3)
+		{
+			return { { a.data[1] * b.data[2] - a.data[2] * b.data[1], a.data[2] * b.data[0] - a.data[0] * b.data[2], a.data[0] * b.data[1] - a.data[1] * b.data[0] } };
+		}
+
+		float Length() const
+		{
+			return std::sqrt(Dot(*this, *this));
+		}
+
+		ScalarVector Normalize() const
+		{
+			float length = Length();
+			ScalarVector result;
+
+			for (size_t i = 0; i < N; ++i)
+				result.data[i] = data[i] / length;
+
+			return result;
+		}
+	};
+
+	template <size_t N>
+	struct LockedVector
+	{
+		std::array<float, N> data{};
+		mutable std::shared_ptr<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
+
+		float& operator[](size_t index)
+		{
+			std::shared_lock lock(*mutex);
+
+			return data[index];
+		}
+
+		float operator[](size_t index) const
+		{
+			std::shared_lock lock(*mutex);
+
+			return data[index];
+		}
+
+		LockedVector operator+(const LockedVector& other) const
+		{
+			std::shared_lock lock(*mutex);
+			std::shared_lock lock_other(*other.mutex);
+
+			LockedVector result;
+
+			for (size_t i = 0; i < N; ++i)
+				result.data[i] = data[i] + other.data[i];
+
+			return result;
+		}
+
+		static float Dot(const LockedVector& a, const LockedVector& b)
+		{
+			std::shared_lock lock_a(*a.mutex);
+			std::shared_lock lock_b(*b.mutex);
+
+			float result = 0.0f;
+
+			for (size_t i = 0; i < N; ++i)
+				result += a.data[i] * b.data[i];
+
+			return result;
+		}
+
+		static LockedVector Cross(const LockedVector& a, const LockedVector& b) requires (N == 3)
+		{
+			std::shared_lock lock_a(*a.mutex);
+			std::shared_lock lock_b(*b.mutex);
+
+			LockedVector result;
+
+			result.data[0] = a.data[1] * b.data[2] - a.data[2] * b.data[1];
+			result.data[1] = a.data[2] * b.data[0] - a.data[0] * b.data[2];
+			result.data[2] = a.data[0] * b.data[1] - a.data[1] * b.data[0];
+
+			return result;
+		}
+
+		float Length() const
+		{
+			return std::sqrt(Dot(*this, *this));
+		}
+
+		LockedVector Normalize() const
+		{
+			std::shared_lock lock(*mutex);
+
+			float length = Length();
+			LockedVector result;
+
+			for (size_t i = 0; i < N; ++i)
+				result.data[i] = data[i] / length;
+
+			return result;
+		}
+	};
+
+	template <typename V, size_t N>
+	std::vector<V> MakeVectors(float seed)
+	{
+		std::vector<V> result(ElementCount);
+
+		for (size_t i = 0; i < ElementCount; ++i)
+		{
+			for (size_t j = 0; j < N; ++j)
+				result[i][j] = seed + static_cast<float>((i * 31 + j * 7) % 97) * 0.125f;
+		}
+
+		return result;
+	}
+
+	template <typename V, size_t N>
+	void VectorBenchmarks(std::string_view backend)
+	{
+		std::string name = std::string(backend) + " float" + std::to_string(N);
+
+		const std::vector<V> a = MakeVectors<V, N>(1.0f);
+		const std::vector<V> b = MakeVectors<V, N>(2.0f);
+
+		Benchmark::Run("Vector.construct", name, 1 << 20, [](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				V value;
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Vector.copy", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				V value = a[i & (ElementCount - 1)];
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Vector.add", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				V value = a[i & (ElementCount - 1)] + b[i & (ElementCount - 1)];
+
+				DoNotOptimize(value);
+			}
+		});
+
+		Benchmark::Run("Vector.dot", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			float sum = 0.0f;
+
+			for (size_t i = 0; i < operations; ++i)
+				sum += V::Dot(a[i & (ElementCount - 1)], b[i & (ElementCount - 1)]);
+
+			DoNotOptimize(sum);
+		});
+
+		if constexpr (N == 3)
+		{
+			Benchmark::Run("Vector.cross", name, 1 << 20, [&](size_t, size_t operations)
+			{
+				for (size_t i = 0; i < operations; ++i)
+				{
+					V value = V::Cross(a[i & (ElementCount - 1)], b[i & (ElementCount - 1)]);
+
+					DoNotOptimize(value);
+				}
+			});
+		}
+
+		Benchmark::Run("Vector.length", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			float sum = 0.0f;
+
+			for (size_t i = 0; i < operations; ++i)
+				sum += a[i & (ElementCount - 1)].Length();
+
+			DoNotOptimize(sum);
+		});
+
+		Benchmark::Run("Vector.normalize", name, 1 << 20, [&](size_t, size_t operations)
+		{
+			for (size_t i = 0; i < operations; ++i)
+			{
+				V value = a[i & (ElementCount - 1)].Normalize();
+
+				DoNotOptimize(value);
+			}
+		});
+	}
+
+	template <size_t N>
+	void WidthBenchmarks()
+	{
+		VectorBenchmarks<LockedVector<N>, N>("before (locked)");
+		VectorBenchmarks<Invasion::Math::Vector<float, N>, N>("after (Math::Vector)");
+		VectorBenchmarks<ScalarVector<N>, N>("scalar reference");
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	Benchmark::Initialize(argumentCount, arguments);
+
+	WidthBenchmarks<2>();
+	WidthBenchmarks<3>();
+	WidthBenchmarks<4>();
+}
\ No newline at end of file
@@ -3,10 +3,12 @@
 #include "Core/InputManager.hpp"
 #include "ECS/GameObjectManager.hpp"
 #include "Entity/Entities/EntityPlayer.hpp"
+#include "Math/TransformHierarchy.hpp"
 #include "Render/Mesh.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/ShaderManager.hpp"
 #include "Render/TextureManager.hpp"
+#include "Util/Memory/FrameArena.hpp"
 #include "Util/XXML/Parser.hpp"
 
 using namespace winrt;
@@ -22,6 +24,7 @@ using namespace Invasion::Core;
 using namespace Invasion::Entity;
 using namespace Invasion::Entity::Entities;
 using namespace Invasion::Render;
+using namespace Invasion::Util::Memory;
 
 struct App : implements<App, IFrameworkViewSource, IFrameworkView>
 {
@@ -75,8 +78,13 @@ struct App : implements<App, IFrameworkViewSource, IFrameworkView>
 
 	void Update()
 	{
+		TransformHierarchy::GetInstance().SetPhase(FramePhase::Update);
+
 		InputManager::GetInstance().Update();
 		GameObjectManager::GetInstance().Update();
+		TransformHierarchy::GetInstance().Update();
+
+		TransformHierarchy::GetInstance().SetPhase(FramePhase::Render);
 	}
 
 	void Render()
@@ -95,6 +103,8 @@ struct App : implements<App, IFrameworkViewSource, IFrameworkView>
 
 	void Uninitialize()
 	{
+		TransformHierarchy::GetInstance().SetPhase(FramePhase::Update);
+
 		GameObjectManager::GetInstance().Uninitialize();
 		ShaderManager::GetInstance().Uninitialize();
 		Renderer::GetInstance().Uninitialize();
@@ -120,6 +130,8 @@ struct App : implements<App, IFrameworkViewSource, IFrameworkView>
 			Render();
 
 			dispatcher.ProcessEvents(CoreProcessEventsOption::ProcessAllIfPresent);
+
+			FrameArena::GetInstance().Reset();
 		}
 	}
 
@@ -127,7 +139,7 @@ struct App : implements<App, IFrameworkViewSource, IFrameworkView>
 	{
 		Shared<XXML::Lexer> lexer = XXML::Lexer::Create(FileSystem::ReadFile(AssetPath{ "EngineSettings.xxml", "Invasion" }.GetFullPath()));
 
-		MutableArray<XXML::Token> tokens;
+		LocalArray<XXML::Token> tokens;
 
 		try
 		{
@@ -26,6 +26,9 @@ namespace Invasion::ECS
             component->gameObject = shared_from_this();
             component->Initialize();
 
+            if (!components.Contains(std::type_index(typeid(T))))
+                componentList += component;
+
             components |= { std::type_index(typeid(T)), component };
 
             return std::static_pointer_cast<T>(components[std::type_index(typeid(T))]);
@@ -60,76 +63,41 @@ namespace Invasion::ECS
 
             std::shared_lock lock(*mutex);
 
-            components[std::type_index(typeid(T))]->Uninitialize();
+            Shared<Component> component = components[std::type_index(typeid(T))];
+
+            component->Uninitialize();
 
+            componentList -= component;
             components -= std::type_index(typeid(T));
         }
 
         void Update()
         {
-            MutableArray<Shared<Component>> componentsCopy;
-
-            {
-                std::shared_lock lock(*mutex);
+            auto componentsSnapshot = componentList.Snapshot();
 
-                components.ForEach([&](const Shared<Component>& component)
-                {
-                    componentsCopy += component;
-                });
-            }
-
-            for (const auto& component : componentsCopy)
+            for (const auto& component : *componentsSnapshot)
                 component->Update();
 
+            auto childrenSnapshot = childList.Snapshot();
 
-            MutableArray<Shared<GameObject>> childrenCopy;
-
-            {
-                std::shared_lock lock(*mutex);
-
-                children.ForEach([&](const Shared<GameObject>& child)
-                {
-                    childrenCopy += child;
-                });
-            }
-
-            for (const auto& child : childrenCopy)
+            for (const auto& child : *childrenSnapshot)
                 child->Update();
         }
 
         void Render(const Shared<Invasion::Render::Camera>& camera)
         {
-            MutableArray<Shared<Component>> componentsCopy;
-
-            {
-                std::shared_lock lock(*mutex);
-
-                components.ForEach([&](const Shared<Component>& component)
-                {
-                    componentsCopy += component;
-                });
-            }
+            auto componentsSnapshot = componentList.Snapshot();
 
-            for (const auto& component : componentsCopy)
+            for (const auto& component : *componentsSnapshot)
                 component->Render(camera);
 
+            auto childrenSnapshot = childList.Snapshot();
 
-            MutableArray<Shared<GameObject>> childrenCopy;
-
-            {
-                std::shared_lock lock(*mutex);
-
-                children.ForEach([&](const Shared<GameObject>& child)
-                {
-                    childrenCopy += child;
-                });
-            }
-
-            for (const auto& child : childrenCopy)
+            for (const auto& child : *childrenSnapshot)
                 child->Render(camera);
         }
 
-        NarrowString GetName() const
+        Name GetName() const
         {
             std::shared_lock lock(*mutex);
             return name;
@@ -142,37 +110,18 @@ namespace Invasion::ECS
 
         void Uninitialize()
         {
-            MutableArray<Shared<Component>> componentsCopy;
+            auto componentsSnapshot = componentList.Exchange();
 
-            {
-                //std::shared_lock lock(*mutex);
-
-                components.ForEach([&](const Shared<Component>& component)
-                {
-                    componentsCopy += component;
-                });
-
-                components.Clear();
-            }
+            components.Clear();
 
-            for (const auto& component : componentsCopy)
+            for (const auto& component : *componentsSnapshot)
                 component->Uninitialize();
 
+            auto childrenSnapshot = childList.Exchange();
 
-            MutableArray<Shared<GameObject>> childrenCopy;
+            children.Clear();
 
-            {
-                //std::shared_lock lock(*mutex);
-
-                children.ForEach([&](const Shared<GameObject>& child)
-                {
-                    childrenCopy += child;
-                });
-
-                children.Clear();
-            }
-
-            for (const auto& child : childrenCopy)
+            for (const auto& child : *childrenSnapshot)
                 child->Uninitialize();
         }
 
@@ -226,14 +175,14 @@ namespace Invasion::ECS
             return parent.lock();
         }
 
-		Shared<GameObject> GetChild(const NarrowString& name) const
+		Shared<GameObject> GetChild(const Name& name) const
 		{
 			std::shared_lock lock(*mutex);
 
 			return children[name];
 		}
 
-        const UnorderedMap<NarrowString, Shared<GameObject>>& GetChildren() const
+        const FlatMap<Name, Shared<GameObject>>& GetChildren() const
         {
             std::shared_lock lock(*mutex);
 
@@ -260,23 +209,33 @@ namespace Invasion::ECS
 			//TODO: Fix deadlock
             //std::unique_lock lock(*mutex);
 
-            children[child->GetName()] = child;
+            Name childName = child->GetName();
+
+            if (children.Contains(childName))
+                childList.Replace(children[childName], child);
+            else
+                childList += child;
+
+            children[childName] = child;
         }
 
         void RemoveChildInternal(const Shared<GameObject>& child)
         {
             std::unique_lock lock(*mutex);
 
+            childList -= child;
             children -= child->GetName();
         }
 
-        NarrowString name;
+        Name name;
         
         Weak<GameObject> parent;
-        UnorderedMap<NarrowString, Shared<GameObject>> children;
+        FlatMap<Name, Shared<GameObject>> children;
+        SnapshotArray<Shared<GameObject>> childList;
 
         Shared<std::shared_mutex> mutex;
 
-        UnorderedMap<std::type_index, Shared<Component>> components;
+        FlatMap<std::type_index, Shared<Component>> components;
+        SnapshotArray<Shared<Component>> componentList;
     };
 }
\ No newline at end of file
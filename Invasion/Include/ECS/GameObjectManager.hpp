@@ -14,80 +14,63 @@ namespace Invasion::ECS
 
 		Shared<GameObject> Register(const Shared<GameObject>& gameObject)
 		{
-			std::unique_lock lock(*mutex);
+			Shared<GameObject> result = gameObjects.GetOrInsert(gameObject->GetName(), gameObject);
 
-			NarrowString name = gameObject->GetName();
+			if (result == gameObject)
+				gameObjectList += gameObject;
 
-			gameObjects |= { name, gameObject };
-
-			return gameObjects[name];
+			return result;
 		}
 
-		Shared<GameObject> Get(const NarrowString& name)
+		Shared<GameObject> Get(const Name& name)
 		{
-			std::shared_lock lock(*mutex);
+			return gameObjects.Get(name);
+		}
 
-			return gameObjects[name];
+		template <typename Key> requires std::constructible_from<Name, const Key&>
+		Shared<GameObject> Get(const Key& name)
+		{
+			return gameObjects.Get(Name::Find(name));
 		}
 
 		void Update()
 		{
-			MutableArray<Shared<GameObject>> gameObjectsCopy;
-
-			{
-				std::shared_lock lock(*mutex);
+			auto gameObjectsSnapshot = gameObjectList.Snapshot();
 
-				gameObjects.ForEach([&](const Shared<GameObject>& gameObject)
-				{
-					gameObjectsCopy += gameObject;
-				});
-			}
-
-			for (const auto& gameObject : gameObjectsCopy)
+			for (const auto& gameObject : *gameObjectsSnapshot)
 				gameObject->Update();
 		}
 
 		void Render(const Shared<Invasion::Render::Camera>& camera)
 		{
-			MutableArray<Shared<GameObject>> gameObjectsCopy;
-
-			{
-				std::shared_lock lock(*mutex);
-
-				gameObjects.ForEach([&](const Shared<GameObject>& gameObject)
-				{
-					gameObjectsCopy += gameObject;
-				});
-			}
+			auto gameObjectsSnapshot = gameObjectList.Snapshot();
 
-			for (const auto& gameObject : gameObjectsCopy)
+			for (const auto& gameObject : *gameObjectsSnapshot)
 				gameObject->Render(camera);
 		}
 
-		void Unregister(const NarrowString& name)
+		void Unregister(const Name& name)
 		{
-			std::unique_lock lock(*mutex);
+			if (auto gameObject = gameObjects.Extract(name))
+			{
+				gameObjectList -= *gameObject;
+				(*gameObject)->Uninitialize();
+			}
+		}
 
-			gameObjects[name]->Uninitialize();
-			gameObjects -= name;
+		template <typename Key> requires std::constructible_from<Name, const Key&>
+		void Unregister(const Key& name)
+		{
+			Unregister(Name::Find(name));
 		}
 
 		void Uninitialize()
 		{
-			MutableArray<Shared<GameObject>> gameObjectsCopy;
+			auto gameObjectsSnapshot = gameObjectList.Exchange();
 
-			{
-				std::unique_lock lock(*mutex);
-
-				gameObjects.ForEach([&](const Shared<GameObject>& gameObject)
-				{
-					gameObjectsCopy += gameObject;
-				});
+			gameObjects.Clear();
 
-				gameObjects.Clear();
-			}
-
-			for (const auto& gameObject : gameObjectsCopy)
+			for (const auto& gameObject : *gameObjectsSnapshot)
 				gameObject->Uninitialize();
 		}
 
@@ -105,9 +88,8 @@ namespace Invasion::ECS
 
 		GameObjectManager() = default;
 
-		Shared<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
-
-		UnorderedMap<NarrowString, Shared<GameObject>> gameObjects;
+		ConcurrentMap<Name, Shared<GameObject>> gameObjects;
+		SnapshotArray<Shared<GameObject>> gameObjectList;
 
 		static Unique<GameObjectManager> instance;
 		static std::once_flag initFlag;
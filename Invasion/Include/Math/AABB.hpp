@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include "Math/Matrix.hpp"
+
+namespace Invasion::Math
+{
+    class AABB
+    {
+
+    public:
+
+        AABB() : minimum(std::numeric_limits<float>::infinity()), maximum(-std::numeric_limits<float>::infinity()) { }
+
+        AABB(const Vector<float, 3>& minimum, const Vector<float, 3>& maximum) : minimum(minimum), maximum(maximum) { }
+
+        const Vector<float, 3>& GetMin() const
+        {
+            return minimum;
+        }
+
+        const Vector<float, 3>& GetMax() const
+        {
+            return maximum;
+        }
+
+        Vector<float, 3> GetCenter() const
+        {
+            return (minimum + maximum) * 0.5f;
+        }
+
+        Vector<float, 3> GetExtents() const
+        {
+            return (maximum - minimum) * 0.5f;
+        }
+
+        std::array<Vector<float, 3>, 8> GetCorners() const
+        {
+            std::array<Vector<float, 3>, 8> corners;
+
+            for (size_t i = 0; i < 8; ++i)
+                corners[i] = { i & 1 ? maximum[0] : minimum[0], i & 2 ? maximum[1] : minimum[1], i & 4 ? maximum[2] : minimum[2] };
+
+            return corners;
+        }
+
+        bool IsEmpty() const
+        {
+            return minimum[0] > maximum[0] || minimum[1] > maximum[1] || minimum[2] > maximum[2];
+        }
+
+        bool Contains(const Vector<float, 3>& point) const
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (point[i] < minimum[i] || point[i] > maximum[i])
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool Contains(const AABB& other) const
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (other.minimum[i] < minimum[i] || other.maximum[i] > maximum[i])
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool Intersects(const AABB& other) const
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (other.maximum[i] < minimum[i] || other.minimum[i] > maximum[i])
+                    return false;
+            }
+
+            return true;
+        }
+
+        AABB Expand(const Vector<float, 3>& point) const
+        {
+            return { Vector<float, 3>::Min(minimum, point), Vector<float, 3>::Max(maximum, point) };
+        }
+
+        AABB Transform(const Matrix<float, 4, 4>& matrix) const
+        {
+            if (IsEmpty())
+                return *this;
+
+            Vector<float, 3> extents = GetExtents();
+            Vector<float, 3> center = matrix.TransformPoint(GetCenter());
+
+            Vector<float, 3> transformed = Vector<float, 3>{ matrix[0][0], matrix[0][1], matrix[0][2] }.Abs() * extents[0];
+
+            transformed += Vector<float, 3>{ matrix[1][0], matrix[1][1], matrix[1][2] }.Abs() * extents[1];
+            transformed += Vector<float, 3>{ matrix[2][0], matrix[2][1], matrix[2][2] }.Abs() * extents[2];
+
+            return FromCenterExtents(center, transformed);
+        }
+
+        static AABB Merge(const AABB& a, const AABB& b)
+        {
+            return { Vector<float, 3>::Min(a.minimum, b.minimum), Vector<float, 3>::Max(a.maximum, b.maximum) };
+        }
+
+        static AABB FromCenterExtents(const Vector<float, 3>& center, const Vector<float, 3>& extents)
+        {
+            return { center - extents, center + extents };
+        }
+
+        static AABB FromPoints(const Vector<float, 3>* points, size_t count)
+        {
+            AABB result;
+
+            for (size_t i = 0; i < count; ++i)
+                result = result.Expand(points[i]);
+
+            return result;
+        }
+
+    private:
+
+        Vector<float, 3> minimum;
+        Vector<float, 3> maximum;
+
+    };
+}
\ No newline at end of file
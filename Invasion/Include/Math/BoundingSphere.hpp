@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include "Math/AABB.hpp"
+
+namespace Invasion::Math
+{
+    class BoundingSphere
+    {
+
+    public:
+
+        BoundingSphere() : center{ 0.0f, 0.0f, 0.0f }, radius(0.0f) { }
+
+        BoundingSphere(const Vector<float, 3>& center, float radius) : center(center), radius(radius) { }
+
+        const Vector<float, 3>& GetCenter() const
+        {
+            return center;
+        }
+
+        float GetRadius() const
+        {
+            return radius;
+        }
+
+        bool Contains(const Vector<float, 3>& point) const
+        {
+            return Vector<float, 3>::DistanceSquared(center, point) <= radius * radius;
+        }
+
+        bool Intersects(const BoundingSphere& other) const
+        {
+            float reach = radius + other.radius;
+
+            return Vector<float, 3>::DistanceSquared(center, other.center) <= reach * reach;
+        }
+
+        bool Intersects(const AABB& box) const
+        {
+            Vector<float, 3> closest = Vector<float, 3>::Clamp(center, box.GetMin(), box.GetMax());
+
+            return Vector<float, 3>::DistanceSquared(center, closest) <= radius * radius;
+        }
+
+        BoundingSphere Transform(const Matrix<float, 4, 4>& matrix) const
+        {
+            float scale = 0.0f;
+
+            for (size_t i = 0; i < 3; ++i)
+                scale = std::max(scale, Vector<float, 3>{ matrix[i][0], matrix[i][1], matrix[i][2] }.LengthSquared());
+
+            return { matrix.TransformPoint(center), radius * std::sqrt(scale) };
+        }
+
+        static BoundingSphere Merge(const BoundingSphere& a, const BoundingSphere& b)
+        {
+            Vector<float, 3> offset = b.center - a.center;
+
+            float distance = offset.Length();
+
+            if (distance + b.radius <= a.radius)
+                return a;
+
+            if (distance + a.radius <= b.radius)
+                return b;
+
+            float radius = (distance + a.radius + b.radius) * 0.5f;
+
+            return { a.center + offset * ((radius - a.radius) / distance), radius };
+        }
+
+        static BoundingSphere FromAABB(const AABB& box)
+        {
+            return { box.GetCenter(), box.GetExtents().Length() };
+        }
+
+        static BoundingSphere FromPoints(const Vector<float, 3>* points, size_t count)
+        {
+            if (count == 0)
+                return {};
+
+            Vector<float, 3> center = AABB::FromPoints(points, count).GetCenter();
+
+            float radiusSquared = 0.0f;
+
+            for (size_t i = 0; i < count; ++i)
+                radiusSquared = std::max(radiusSquared, Vector<float, 3>::DistanceSquared(center, points[i]));
+
+            return { center, std::sqrt(radiusSquared) };
+        }
+
+    private:
+
+        Vector<float, 3> center;
+        float radius;
+
+    };
+}
\ No newline at end of file
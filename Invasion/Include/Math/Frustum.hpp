@@ -0,0 +1,193 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include "Math/AABB.hpp"
+#include "Math/BoundingSphere.hpp"
+#include "Math/OBB.hpp"
+#include "Math/Plane.hpp"
+#include "Math/Simd.hpp"
+
+namespace Invasion::Math
+{
+    class Frustum
+    {
+
+    public:
+
+        static constexpr size_t Left = 0;
+        static constexpr size_t Right = 1;
+        static constexpr size_t Bottom = 2;
+        static constexpr size_t Top = 3;
+        static constexpr size_t Near = 4;
+        static constexpr size_t Far = 5;
+
+        Frustum() = default;
+
+        explicit Frustum(const std::array<Plane, 6>& planes) : planes(planes) { }
+
+        const Plane& GetPlane(size_t index) const
+        {
+            return planes[index];
+        }
+
+        bool Contains(const Vector<float, 3>& point) const
+        {
+            for (const Plane& plane : planes)
+            {
+                if (plane.DistanceTo(point) < 0.0f)
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool Intersects(const BoundingSphere& sphere) const
+        {
+            for (const Plane& plane : planes)
+            {
+                if (plane.DistanceTo(sphere.GetCenter()) < -sphere.GetRadius())
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool Intersects(const AABB& box) const
+        {
+            Vector<float, 3> center = box.GetCenter();
+            Vector<float, 3> extents = box.GetExtents();
+
+            for (const Plane& plane : planes)
+            {
+                if (plane.DistanceTo(center) < -Vector<float, 3>::Dot(plane.GetNormal().Abs(), extents))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool Intersects(const OBB& box) const
+        {
+            for (const Plane& plane : planes)
+            {
+                if (plane.DistanceTo(box.GetCenter()) < -box.ProjectExtents(plane.GetNormal()))
+                    return false;
+            }
+
+            return true;
+        }
+
+        void Intersects(const AABB* boxes, bool* results, size_t count) const
+        {
+            size_t i = 0;
+
+#if INVASION_MATH_AVX
+            for (; i < count - count % 8; i += 8)
+            {
+                __m128 low[6], high[6];
+
+                LoadBoxes(boxes + i, low);
+                LoadBoxes(boxes + i + 4, high);
+
+                __m256 lanes[6];
+
+                for (size_t k = 0; k < 6; ++k)
+                    lanes[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(low[k]), high[k], 1);
+
+                __m256 outside = _mm256_setzero_ps();
+
+                for (const Plane& plane : planes)
+                {
+                    const Vector<float, 3>& normal = plane.GetNormal();
+
+                    __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(lanes[0], _mm256_set1_ps(normal[0])), _mm256_mul_ps(lanes[1], _mm256_set1_ps(normal[1]))), _mm256_add_ps(_mm256_mul_ps(lanes[2], _mm256_set1_ps(normal[2])), _mm256_set1_ps(plane.GetDistance())));
+                    __m256 reach = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(lanes[3], _mm256_set1_ps(std::abs(normal[0]))), _mm256_mul_ps(lanes[4], _mm256_set1_ps(std::abs(normal[1])))), _mm256_mul_ps(lanes[5], _mm256_set1_ps(std::abs(normal[2]))));
+
+                    outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, reach), _mm256_setzero_ps(), _CMP_LT_OQ));
+                }
+
+                int mask = _mm256_movemask_ps(outside);
+
+                for (size_t k = 0; k < 8; ++k)
+                    results[i + k] = !(mask & (1 << k));
+            }
+#endif
+
+#if INVASION_MATH_SSE
+            for (; i < count - count % 4; i += 4)
+            {
+                __m128 lanes[6];
+
+                LoadBoxes(boxes + i, lanes);
+
+                __m128 outside = _mm_setzero_ps();
+
+                for (const Plane& plane : planes)
+                {
+                    const Vector<float, 3>& normal = plane.GetNormal();
+
+                    __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lanes[0], _mm_set1_ps(normal[0])), _mm_mul_ps(lanes[1], _mm_set1_ps(normal[1]))), _mm_add_ps(_mm_mul_ps(lanes[2], _mm_set1_ps(normal[2])), _mm_set1_ps(plane.GetDistance())));
+                    __m128 reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lanes[3], _mm_set1_ps(std::abs(normal[0]))), _mm_mul_ps(lanes[4], _mm_set1_ps(std::abs(normal[1])))), _mm_mul_ps(lanes[5], _mm_set1_ps(std::abs(normal[2]))));
+
+                    outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, reach), _mm_setzero_ps()));
+                }
+
+                int mask = _mm_movemask_ps(outside);
+
+                for (size_t k = 0; k < 4; ++k)
+                    results[i + k] = !(mask & (1 << k));
+            }
+#endif
+
+            for (; i < count; ++i)
+                results[i] = Intersects(boxes[i]);
+        }
+
+        static Frustum FromMatrix(const Matrix<float, 4, 4>& viewProjection)
+        {
+            auto column = [&](size_t index)
+            {
+                return Vector<float, 4>{ viewProjection[0][index], viewProjection[1][index], viewProjection[2][index], viewProjection[3][index] };
+            };
+
+            auto plane = [](const Vector<float, 4>& coefficients)
+            {
+                return Plane({ coefficients[0], coefficients[1], coefficients[2] }, coefficients[3]).Normalize();
+            };
+
+            Vector<float, 4> x = column(0), y = column(1), z = column(2), w = column(3);
+
+            return Frustum({ plane(w + x), plane(w - x), plane(w + y), plane(w - y), plane(z), plane(w - z) });
+        }
+
+    private:
+
+#if INVASION_MATH_SSE
+        static void LoadBoxes(const AABB* boxes, __m128 (&lanes)[6])
+        {
+            __m128 min[4], max[4];
+
+            for (size_t k = 0; k < 4; ++k)
+            {
+                min[k] = _mm_load_ps(boxes[k].GetMin().begin());
+                max[k] = _mm_load_ps(boxes[k].GetMax().begin());
+            }
+
+            _MM_TRANSPOSE4_PS(min[0], min[1], min[2], min[3]);
+            _MM_TRANSPOSE4_PS(max[0], max[1], max[2], max[3]);
+
+            __m128 half = _mm_set1_ps(0.5f);
+
+            for (size_t k = 0; k < 3; ++k)
+            {
+                lanes[k] = _mm_mul_ps(_mm_add_ps(min[k], max[k]), half);
+                lanes[k + 3] = _mm_mul_ps(_mm_sub_ps(max[k], min[k]), half);
+            }
+        }
+#endif
+
+        std::array<Plane, 6> planes;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "Math/Simd.hpp"
+#include "Math/Vector.hpp"
+
+namespace Invasion::Math
+{
+    class Half
+    {
+
+    public:
+
+        Half() = default;
+
+        constexpr Half(float value) : bits(FromFloat(value)) { }
+
+        constexpr operator float() const
+        {
+            return ToFloat(bits);
+        }
+
+        constexpr uint16_t GetBits() const
+        {
+            return bits;
+        }
+
+        static constexpr Half FromBits(uint16_t bits)
+        {
+            Half result;
+
+            result.bits = bits;
+
+            return result;
+        }
+
+        static void Convert(const float* source, Half* destination, size_t count)
+        {
+            size_t i = 0;
+
+#if INVASION_MATH_F16C
+            for (; i < count - count % 8; i += 8)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm256_cvtps_ph(_mm256_loadu_ps(source + i), _MM_FROUND_TO_NEAREST_INT));
+#endif
+
+#if INVASION_MATH_SSE
+            for (; i < count - count % 8; i += 8)
+            {
+                __m128i low = FromFloat4(_mm_loadu_ps(source + i));
+                __m128i high = FromFloat4(_mm_loadu_ps(source + i + 4));
+
+                low = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+                high = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packs_epi32(low, high));
+            }
+#endif
+
+            for (; i < count; ++i)
+                destination[i].bits = FromFloat(source[i]);
+        }
+
+        static void Convert(const Half* source, float* destination, size_t count)
+        {
+            size_t i = 0;
+
+#if INVASION_MATH_F16C
+            for (; i < count - count % 8; i += 8)
+                _mm256_storeu_ps(destination + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i))));
+#endif
+
+#if INVASION_MATH_SSE
+            for (; i < count - count % 8; i += 8)
+            {
+                __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+
+                _mm_storeu_ps(destination + i, ToFloat4(_mm_unpacklo_epi16(packed, _mm_setzero_si128())));
+                _mm_storeu_ps(destination + i + 4, ToFloat4(_mm_unpackhi_epi16(packed, _mm_setzero_si128())));
+            }
+#endif
+
+            for (; i < count; ++i)
+                destination[i] = ToFloat(source[i].bits);
+        }
+
+    private:
+
+        static constexpr uint16_t FromFloat(float value)
+        {
+            uint32_t bits = std::bit_cast<uint32_t>(value);
+            uint32_t sign = bits & 0x80000000u;
+
+            bits ^= sign;
+
+            if (bits >= (127u + 16u) << 23)
+                return static_cast<uint16_t>((sign >> 16) | (bits > 255u << 23 ? 0x7E00u : 0x7C00u));
+
+            if (bits < 113u << 23)
+            {
+                constexpr uint32_t magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+                bits = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) + std::bit_cast<float>(magic)) - magic;
+            }
+            else
+            {
+                uint32_t odd = (bits >> 13) & 1u;
+
+                bits = (bits + ((15u - 127u) << 23) + 0xFFFu + odd) >> 13;
+            }
+
+            return static_cast<uint16_t>((sign >> 16) | bits);
+        }
+
+        static constexpr float ToFloat(uint16_t value)
+        {
+            uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+            uint32_t exponent = (value >> 10) & 0x1Fu;
+            uint32_t mantissa = value & 0x3FFu;
+
+            if (exponent == 0x1F)
+                return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+
+            if (exponent == 0)
+            {
+                if (mantissa == 0)
+                    return std::bit_cast<float>(sign);
+
+                exponent = 1;
+
+                while (!(mantissa & 0x400u))
+                {
+                    mantissa <<= 1;
+                    --exponent;
+                }
+
+                mantissa &= 0x3FFu;
+            }
+
+            return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+        }
+
+#if INVASION_MATH_SSE
+        static __m128i FromFloat4(__m128 value)
+        {
+            const __m128i magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+            __m128i bits = _mm_castps_si128(value);
+            __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+
+            bits = _mm_xor_si128(bits, sign);
+
+            __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(magic))), magic);
+
+            __m128i odd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+            __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(static_cast<int>((15u - 127u) << 23) + 0xFFF)), odd), 13);
+
+            __m128i isSubnormal = _mm_cmplt_epi32(bits, _mm_set1_epi32(113 << 23));
+            __m128i result = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+
+            __m128i isOverflow = _mm_cmpgt_epi32(bits, _mm_set1_epi32(((127 + 16) << 23) - 1));
+            __m128i isNan = _mm_cmpgt_epi32(bits, _mm_set1_epi32(255 << 23));
+            __m128i special = _mm_or_si128(_mm_and_si128(isNan, _mm_set1_epi32(0x7E00)), _mm_andnot_si128(isNan, _mm_set1_epi32(0x7C00)));
+
+            result = _mm_or_si128(_mm_and_si128(isOverflow, special), _mm_andnot_si128(isOverflow, result));
+
+            return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+        }
+
+        static __m128 ToFloat4(__m128i value)
+        {
+            __m128i magnitude = _mm_and_si128(value, _mm_set1_epi32(0x7FFF));
+            __m128i sign = _mm_slli_epi32(_mm_xor_si128(value, magnitude), 16);
+
+            __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(magnitude, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+            __m128 infinity = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7BFF))), _mm_castsi128_ps(_mm_set1_epi32(255 << 23)));
+
+            return _mm_or_ps(scaled, _mm_or_ps(_mm_castsi128_ps(sign), infinity));
+        }
+#endif
+
+        uint16_t bits;
+
+    };
+
+    template <>
+    struct ArithmeticTraits<Half>
+    {
+        static constexpr bool IsArithmetic = true;
+    };
+
+    static_assert(sizeof(Half) == 2 && std::is_trivially_copyable_v<Half>);
+    static_assert(sizeof(Vector<Half, 4>) == 8);
+}
\ No newline at end of file
@@ -1,21 +1,41 @@
 #pragma once
 
-#include <DirectXMath.h>
+#include <limits>
+#include <numbers>
+#include "Math/Scalar.hpp"
+#include "Math/Simd.hpp"
 #include "Math/Vector.hpp"
 
 namespace Invasion::Math
 {
+    template <typename T, size_t R, size_t C>
+    struct MatrixStorage
+    {
+        static constexpr bool IsSimd = false;
+        static constexpr size_t Alignment = alignof(T);
+    };
+
+    template <>
+    struct MatrixStorage<float, 4, 4>
+    {
+        static constexpr bool IsSimd = true;
+        static constexpr size_t Alignment = 16;
+    };
+
     template <typename T, size_t R, size_t C>
     class Matrix
     {
 
+        using Storage = MatrixStorage<T, R, C>;
+
     public:
+
+        static constexpr bool IsSimd = Storage::IsSimd;
         
-        Matrix() : data_{} { }
+        constexpr Matrix() = default;
 
-        Matrix(const std::initializer_list<std::initializer_list<T>>& list)
+        constexpr Matrix(const std::initializer_list<std::initializer_list<T>>& list)
         {
-            std::unique_lock lock(mutex_);
             size_t i = 0;
 
             for (const auto& row : list)
@@ -45,54 +65,10 @@ namespace Invasion::Math
                 data_[i].fill(T{});
         }
 
-        Matrix(const Matrix& other)
-        {
-            std::shared_lock lock(other.mutex_);
-            data_ = other.data_;
-        }
-
-        Matrix(Matrix&& other) noexcept
-        {
-            std::unique_lock lock(other.mutex_);
-            data_ = std::move(other.data_);
-        }
-
-        Matrix& operator=(const Matrix& other)
-        {
-            if (this != &other)
-            {
-                std::unique_lock lock1(mutex_, std::defer_lock);
-                std::shared_lock lock2(other.mutex_, std::defer_lock);
-                std::lock(lock1, lock2);
-
-                data_ = other.data_;
-            }
-
-            return *this;
-        }
-
-        Matrix& operator=(Matrix&& other) noexcept
-        {
-            if (this != &other)
-            {
-                std::unique_lock lock1(mutex_, std::defer_lock);
-                std::unique_lock lock2(other.mutex_, std::defer_lock);
-                std::lock(lock1, lock2);
-                data_ = std::move(other.data_);
-            }
-
-            return *this;
-        }
-
-        Matrix operator+(const Matrix& other) const
+        constexpr Matrix operator+(const Matrix& other) const
         {
             Matrix result;
 
-            std::shared_lock lock1(mutex_, std::defer_lock);
-            std::shared_lock lock2(other.mutex_, std::defer_lock);
-
-            std::lock(lock1, lock2);
-
             for (size_t i = 0; i < R; ++i)
             {
                 for (size_t j = 0; j < C; ++j)
@@ -102,15 +78,10 @@ namespace Invasion::Math
             return result;
         }
 
-        Matrix operator-(const Matrix& other) const
+        constexpr Matrix operator-(const Matrix& other) const
         {
             Matrix result;
 
-            std::shared_lock lock1(mutex_, std::defer_lock);
-            std::shared_lock lock2(other.mutex_, std::defer_lock);
-
-            std::lock(lock1, lock2);
-
             for (size_t i = 0; i < R; ++i)
             {
                 for (size_t j = 0; j < C; ++j)
@@ -120,10 +91,9 @@ namespace Invasion::Math
             return result;
         }
 
-        Matrix operator*(T scalar) const
+        constexpr Matrix operator*(T scalar) const
         {
             Matrix result;
-            std::shared_lock lock(mutex_);
 
             for (size_t i = 0; i < R; ++i)
             {
@@ -134,13 +104,12 @@ namespace Invasion::Math
             return result;
         }
 
-        Matrix operator/(T scalar) const
+        constexpr Matrix operator/(T scalar) const
         {
             if (scalar == T{})
                 throw std::invalid_argument("Division by zero");
             
             Matrix result;
-            std::shared_lock lock(mutex_);
 
             for (size_t i = 0; i < R; ++i)
             {
@@ -151,12 +120,8 @@ namespace Invasion::Math
             return result;
         }
 
-        Matrix& operator+=(const Matrix& other)
+        constexpr Matrix& operator+=(const Matrix& other)
         {
-            std::unique_lock lock1(mutex_, std::defer_lock);
-            std::shared_lock lock2(other.mutex_, std::defer_lock);
-            std::lock(lock1, lock2);
-
             for (size_t i = 0; i < R; ++i)
             {
                 for (size_t j = 0; j < C; ++j)
@@ -166,12 +131,8 @@ namespace Invasion::Math
             return *this;
         }
 
-        Matrix& operator-=(const Matrix& other)
+        constexpr Matrix& operator-=(const Matrix& other)
         {
-            std::unique_lock lock1(mutex_, std::defer_lock);
-            std::shared_lock lock2(other.mutex_, std::defer_lock);
-            std::lock(lock1, lock2);
-
             for (size_t i = 0; i < R; ++i)
             {
                 for (size_t j = 0; j < C; ++j)
@@ -181,34 +142,15 @@ namespace Invasion::Math
             return *this;
         }
 
-		Matrix& operator*=(const Matrix& other)
+		constexpr Matrix& operator*=(const Matrix& other)
 		{
-			std::unique_lock lock1(mutex_, std::defer_lock);
-			std::shared_lock lock2(other.mutex_, std::defer_lock);
-			std::lock(lock1, lock2);
-
-			Matrix result;
-
-			for (size_t i = 0; i < R; ++i)
-			{
-				for (size_t j = 0; j < C; ++j)
-				{
-					T sum = T{};
-					for (size_t k = 0; k < C; ++k)
-						sum += data_[i][k] * other.data_[k][j];
-					result.data_[i][j] = sum;
-				}
-			}
-
-			data_ = result.data_;
+			*this = *this * other;
 
 			return *this;
 		}
 
-        Matrix& operator*=(T scalar)
+        constexpr Matrix& operator*=(T scalar)
         {
-            std::unique_lock lock(mutex_);
-
             for (size_t i = 0; i < R; ++i)
             {
                 for (size_t j = 0; j < C; ++j)
@@ -218,12 +160,8 @@ namespace Invasion::Math
             return *this;
         }
 
-        Matrix& operator/=(const Matrix& other)
+        constexpr Matrix& operator/=(const Matrix& other)
 		{
-			std::unique_lock lock1(mutex_, std::defer_lock);
-			std::shared_lock lock2(other.mutex_, std::defer_lock);
-			std::lock(lock1, lock2);
-
 			for (size_t i = 0; i < R; ++i)
 			{
 				for (size_t j = 0; j < C; ++j)
@@ -238,13 +176,11 @@ namespace Invasion::Math
 			return *this;
 		}
 
-        Matrix& operator/=(T scalar)
+        constexpr Matrix& operator/=(T scalar)
         {
             if (scalar == T{})
                 throw std::invalid_argument("Division by zero");
             
-            std::unique_lock lock(mutex_);
-
             for (size_t i = 0; i < R; ++i)
             {
                 for (size_t j = 0; j < C; ++j)
@@ -254,13 +190,8 @@ namespace Invasion::Math
             return *this;
         }
 
-        bool operator==(const Matrix& other) const
+        constexpr bool operator==(const Matrix& other) const
         {
-            std::shared_lock lock1(mutex_, std::defer_lock);
-            std::shared_lock lock2(other.mutex_, std::defer_lock);
-
-            std::lock(lock1, lock2);
-
             for (size_t i = 0; i < R; ++i)
             {
                 for (size_t j = 0; j < C; ++j)
@@ -273,28 +204,24 @@ namespace Invasion::Math
             return true;
         }
 
-        bool operator!=(const Matrix& other) const
+        constexpr bool operator!=(const Matrix& other) const
         {
             return !(*this == other);
         }
 
-        T& operator()(size_t row, size_t col)
+        constexpr T& operator()(size_t row, size_t col)
         {
             if (row >= R || col >= C)
                 throw std::out_of_range("Matrix indices out of range");
             
-            std::unique_lock lock(mutex_);
-
             return data_[row][col];
         }
 
-        const T& operator()(size_t row, size_t col) const
+        constexpr const T& operator()(size_t row, size_t col) const
         {
             if (row >= R || col >= C)
                 throw std::out_of_range("Matrix indices out of range");
             
-            std::shared_lock lock(mutex_);
-
             return data_[row][col];
         }
 
@@ -303,15 +230,13 @@ namespace Invasion::Math
 
         public:
 
-            RowProxy(Matrix& matrix, size_t row) : matrix_(matrix), row_(row) {}
+            constexpr RowProxy(Matrix& matrix, size_t row) : matrix_(matrix), row_(row) {}
 
-            T& operator[](size_t col)
+            constexpr T& operator[](size_t col)
             {
                 if (col >= C)
                     throw std::out_of_range("Column index out of range");
                 
-                std::unique_lock lock(matrix_.mutex_);
-
                 return matrix_.data_[row_][col];
             }
 
@@ -326,15 +251,14 @@ namespace Invasion::Math
 
         public:
 
-            ConstRowProxy(const Matrix& matrix, size_t row) : matrix_(matrix), row_(row) {}
+            constexpr ConstRowProxy(const Matrix& matrix, size_t row) : matrix_(matrix), row_(row) {}
 
-            const T& operator[](size_t col) const
+            constexpr const T& operator[](size_t col) const
             {
                 if (col >= C)
                 {
                     throw std::out_of_range("Column index out of range");
                 }
-                std::shared_lock lock(matrix_.mutex_);
                 return matrix_.data_[row_][col];
             }
 
@@ -344,7 +268,7 @@ namespace Invasion::Math
             size_t row_;
         };
 
-        RowProxy operator[](size_t row)
+        constexpr RowProxy operator[](size_t row)
         {
             if (row >= R)
                 throw std::out_of_range("Row index out of range");
@@ -352,7 +276,7 @@ namespace Invasion::Math
             return RowProxy(*this, row);
         }
 
-        ConstRowProxy operator[](size_t row) const
+        constexpr ConstRowProxy operator[](size_t row) const
         {
             if (row >= R)
                 throw std::out_of_range("Row index out of range");
@@ -360,12 +284,19 @@ namespace Invasion::Math
             return ConstRowProxy(*this, row);
         }
 
-        Matrix<T, C, R> Transpose() const
+        constexpr Matrix<T, C, R> Transpose() const
         {
             Matrix<T, C, R> result;
 
-            std::shared_lock lock(mutex_);
-            std::unique_lock lockResult(result.mutex_);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    Simd::TransposeMatrix(Data(), result.Data());
+
+                    return result;
+                }
+            }
 
             for (size_t i = 0; i < R; ++i)
             {
@@ -376,10 +307,9 @@ namespace Invasion::Math
             return result;
         }
 
-        static Matrix Identity() requires(R == C)
+        static constexpr Matrix Identity() requires(R == C)
         {
             Matrix result;
-            std::unique_lock lock(result.mutex_);
 
             for (size_t i = 0; i < R; ++i)
             {
@@ -390,15 +320,15 @@ namespace Invasion::Math
             return result;
         }
 
-		static Matrix Zero()
+		static constexpr Matrix Zero()
 		{
 			return Matrix();
 		}
 
-        static Matrix Projection(T fov, T aspect, T nearPlane, T farPlane) requires(R == 4 && C == 4)
+        static constexpr Matrix Projection(T fov, T aspect, T nearPlane, T farPlane) requires(R == 4 && C == 4)
         {
             Matrix result;
-            T yScale = 1 / std::tan(fov / 2);
+            T yScale = 1 / Scalar::Tan(fov / 2);
             T xScale = yScale / aspect;
             T zRange = farPlane - nearPlane;
 
@@ -412,7 +342,7 @@ namespace Invasion::Math
             return result;
         }
 
-        static Matrix Orthographic(T left, T right, T bottom, T top, T nearPlane, T farPlane) requires(R == 4 && C == 4)
+        static constexpr Matrix Orthographic(T left, T right, T bottom, T top, T nearPlane, T farPlane) requires(R == 4 && C == 4)
         {
             Matrix result;
 
@@ -420,8 +350,6 @@ namespace Invasion::Math
             T height = top - bottom;
             T depth = farPlane - nearPlane;
 
-            std::unique_lock lock(result.mutex_);
-
             result.data_[0][0] = 2 / width;
             result.data_[1][1] = 2 / height;
             result.data_[2][2] = 1 / depth;
@@ -433,7 +361,7 @@ namespace Invasion::Math
             return result;
         }
 
-        static Matrix LookAt(const Vector<T, 3>& eye, const Vector<T, 3>& target, const Vector<T, 3>& up) requires(R == 4 && C == 4)
+        static constexpr Matrix LookAt(const Vector<T, 3>& eye, const Vector<T, 3>& target, const Vector<T, 3>& up) requires(R == 4 && C == 4)
         {
             Vector<T, 3> zaxis = (target - eye).Normalize();
             Vector<T, 3> xaxis = Vector<T, 3>::Cross(up, zaxis).Normalize();
@@ -464,13 +392,12 @@ namespace Invasion::Math
             return result;
         }
 
-        static Matrix RotationX(T angle) requires(R == 4 && C == 4)
+        static constexpr Matrix RotationX(T angle) requires(R == 4 && C == 4)
         {
             Matrix result;
-            T cosTheta = std::cos(angle);
-            T sinTheta = std::sin(angle);
+            T sinTheta{}, cosTheta{};
 
-            std::unique_lock lock(result.mutex_);
+            Scalar::SinCos(angle, sinTheta, cosTheta);
 
             result.data_[0][0] = 1;
             result.data_[1][1] = cosTheta;
@@ -482,13 +409,12 @@ namespace Invasion::Math
             return result;
         }
 
-        static Matrix RotationY(T angle) requires(R == 4 && C == 4)
+        static constexpr Matrix RotationY(T angle) requires(R == 4 && C == 4)
         {
             Matrix result;
-            T cosTheta = std::cos(angle);
-            T sinTheta = std::sin(angle);
+            T sinTheta{}, cosTheta{};
 
-            std::unique_lock lock(result.mutex_);
+            Scalar::SinCos(angle, sinTheta, cosTheta);
 
             result.data_[0][0] = cosTheta;
             result.data_[0][2] = -sinTheta;
@@ -500,13 +426,12 @@ namespace Invasion::Math
             return result;
         }
 
-        static Matrix RotationZ(T angle) requires(R == 4 && C == 4)
+        static constexpr Matrix RotationZ(T angle) requires(R == 4 && C == 4)
         {
             Matrix result;
-            T cosTheta = std::cos(angle);
-            T sinTheta = std::sin(angle);
+            T sinTheta{}, cosTheta{};
 
-            std::unique_lock lock(result.mutex_);
+            Scalar::SinCos(angle, sinTheta, cosTheta);
 
             result.data_[0][0] = cosTheta;
             result.data_[0][1] = sinTheta;
@@ -518,12 +443,10 @@ namespace Invasion::Math
             return result;
         }
 
-		static Matrix Translation(const Vector<T, 3>& translation) requires(R == 4 && C == 4)
+		static constexpr Matrix Translation(const Vector<T, 3>& translation) requires(R == 4 && C == 4)
 		{
 			Matrix result;
 
-			std::unique_lock lock(result.mutex_);
-
 			result.data_[0][0] = 1;
 			result.data_[1][1] = 1;
 			result.data_[2][2] = 1;
@@ -535,19 +458,29 @@ namespace Invasion::Math
 			return result;
 		}
 
-        static Matrix EulerRotation(const Vector<T, 3>& angles) requires(R == 4 && C == 4)
+        static constexpr Matrix EulerRotation(const Vector<T, 3>& angles) requires(R == 4 && C == 4)
         {
-            Vector<T, 3> radians = angles * (static_cast<T>(DirectX::XM_PI) / 180.0f);
+            Vector<T, 3> sine, cosine;
 
-            return RotationZ(radians[2]) * RotationY(radians[1]) * RotationX(radians[0]);
+            Vector<T, 3>::SinCos(angles * (std::numbers::pi_v<T> / 180), sine, cosine);
+
+            const T sx = sine[0], sy = sine[1], sz = sine[2];
+            const T cx = cosine[0], cy = cosine[1], cz = cosine[2];
+
+            Matrix result;
+
+            result.data_[0] = { cz * cy, sz * cx + cz * sy * sx, sz * sx - cz * sy * cx, 0 };
+            result.data_[1] = { -sz * cy, cz * cx - sz * sy * sx, cz * sx + sz * sy * cx, 0 };
+            result.data_[2] = { sy, -cy * sx, cy * cx, 0 };
+            result.data_[3] = { 0, 0, 0, 1 };
+
+            return result;
         }
 
-        static Matrix Scale(const Vector<T, 3>& scale) requires(R == 4 && C == 4)
+        static constexpr Matrix Scale(const Vector<T, 3>& scale) requires(R == 4 && C == 4)
         {
 			Matrix result;
 
-			std::unique_lock lock(result.mutex_);
-
 			result.data_[0][0] = scale[0];
 			result.data_[1][1] = scale[1];
 			result.data_[2][2] = scale[2];
@@ -556,12 +489,10 @@ namespace Invasion::Math
 			return result;
         }
 
-		static Matrix Transpose(const Matrix& matrix)
+		static constexpr Matrix Transpose(const Matrix& matrix)
 		{
 			Matrix result;
 
-			std::shared_lock lock(matrix.mutex_);
-
 			for (size_t i = 0; i < R; ++i)
 			{
 				for (size_t j = 0; j < C; ++j)
@@ -571,6 +502,171 @@ namespace Invasion::Math
 			return result;
 		}
 
+        constexpr Matrix Inverse() const requires(R == C)
+        {
+            Matrix result;
+
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (Simd::InverseMatrix(Data(), result.Data()) == 0.0f)
+                        throw std::invalid_argument("Matrix is singular");
+
+                    return result;
+                }
+            }
+
+            Matrix source = *this;
+
+            result = Identity();
+
+            for (size_t column = 0; column < C; ++column)
+            {
+                size_t pivot = column;
+
+                for (size_t row = column + 1; row < R; ++row)
+                {
+                    if (Scalar::Abs(source.data_[row][column]) > Scalar::Abs(source.data_[pivot][column]))
+                        pivot = row;
+                }
+
+                if (source.data_[pivot][column] == T{})
+                    throw std::invalid_argument("Matrix is singular");
+
+                std::swap(source.data_[pivot], source.data_[column]);
+                std::swap(result.data_[pivot], result.data_[column]);
+
+                T divisor = source.data_[column][column];
+
+                for (size_t j = 0; j < C; ++j)
+                {
+                    source.data_[column][j] /= divisor;
+                    result.data_[column][j] /= divisor;
+                }
+
+                for (size_t row = 0; row < R; ++row)
+                {
+                    if (row == column)
+                        continue;
+
+                    T factor = source.data_[row][column];
+
+                    for (size_t j = 0; j < C; ++j)
+                    {
+                        source.data_[row][j] -= factor * source.data_[column][j];
+                        result.data_[row][j] -= factor * result.data_[column][j];
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        constexpr Matrix AffineInverse() const requires(R == 4 && C == 4)
+        {
+            Matrix result;
+
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (Simd::AffineInverseMatrix(Data(), result.Data()) == 0.0f)
+                        throw std::invalid_argument("Matrix is singular");
+
+                    return result;
+                }
+            }
+
+            Vector<T, 3> row0 = { data_[0][0], data_[0][1], data_[0][2] };
+            Vector<T, 3> row1 = { data_[1][0], data_[1][1], data_[1][2] };
+            Vector<T, 3> row2 = { data_[2][0], data_[2][1], data_[2][2] };
+
+            Vector<T, 3> column0 = Vector<T, 3>::Cross(row1, row2);
+            Vector<T, 3> column1 = Vector<T, 3>::Cross(row2, row0);
+            Vector<T, 3> column2 = Vector<T, 3>::Cross(row0, row1);
+
+            T determinant = Vector<T, 3>::Dot(row0, column0);
+
+            if (determinant == T{})
+                throw std::invalid_argument("Matrix is singular");
+
+            for (size_t i = 0; i < 3; ++i)
+                result.data_[i] = { column0[i] / determinant, column1[i] / determinant, column2[i] / determinant, T{} };
+
+            for (size_t j = 0; j < 3; ++j)
+                result.data_[3][j] = -(data_[3][0] * result.data_[0][j] + data_[3][1] * result.data_[1][j] + data_[3][2] * result.data_[2][j]);
+
+            result.data_[3][3] = 1;
+
+            return result;
+        }
+
+        constexpr Matrix InverseTranspose() const requires(R == 4 && C == 4)
+        {
+            Matrix result;
+
+            if (ComputeInverseTranspose(result) == T{})
+                throw std::invalid_argument("Matrix is singular");
+
+            return result;
+        }
+
+        constexpr Matrix NormalMatrix() const noexcept requires(R == 4 && C == 4)
+        {
+            Matrix result;
+
+            T determinant = ComputeInverseTranspose(result);
+
+            if (!(Scalar::Abs(determinant) > std::numeric_limits<T>::min()))
+                return Identity();
+
+            return result;
+        }
+
+        constexpr Vector<T, 3> TransformPoint(const Vector<T, 3>& point) const requires(R == 4 && C == 4)
+        {
+            Vector<T, 3> result;
+
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    Simd::Float4x4 matrix = Simd::LoadMatrix(Data());
+
+                    Simd::Store<3>(result.begin(), Simd::Add(Simd::TransformRow(Simd::Load<3>(point.begin()), matrix), matrix.rows[3]));
+
+                    return result;
+                }
+            }
+
+            for (size_t j = 0; j < 3; ++j)
+                result[j] = point[0] * data_[0][j] + point[1] * data_[1][j] + point[2] * data_[2][j] + data_[3][j];
+
+            return result;
+        }
+
+        constexpr Vector<T, 3> TransformVector(const Vector<T, 3>& vector) const requires(R == 4 && C == 4)
+        {
+            Vector<T, 3> result;
+
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    Simd::Store<3>(result.begin(), Simd::TransformRow(Simd::Load<3>(vector.begin()), Simd::LoadMatrix(Data())));
+
+                    return result;
+                }
+            }
+
+            for (size_t j = 0; j < 3; ++j)
+                result[j] = vector[0] * data_[0][j] + vector[1] * data_[1][j] + vector[2] * data_[2][j];
+
+            return result;
+        }
+
+#ifdef DIRECTX_MATH_VERSION
         operator DirectX::XMMATRIX() const
         {
             return DirectX::XMMATRIX(
@@ -580,27 +676,70 @@ namespace Invasion::Math
                 DirectX::XMVectorSet(data_[3][0], data_[3][1], data_[3][2], data_[3][3])
             );
         }
+#endif
 
     private:
 
-        mutable std::shared_mutex mutex_;
+        constexpr T ComputeInverseTranspose(Matrix& result) const noexcept requires(R == 4 && C == 4)
+        {
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Simd::InverseTransposeMatrix(Data(), result.Data());
+            }
+
+            Vector<T, 3> row0 = { data_[0][0], data_[0][1], data_[0][2] };
+            Vector<T, 3> row1 = { data_[1][0], data_[1][1], data_[1][2] };
+            Vector<T, 3> row2 = { data_[2][0], data_[2][1], data_[2][2] };
+
+            Vector<T, 3> cofactors[3] = { Vector<T, 3>::Cross(row1, row2), Vector<T, 3>::Cross(row2, row0), Vector<T, 3>::Cross(row0, row1) };
+
+            T determinant = Vector<T, 3>::Dot(row0, cofactors[0]);
 
-        std::array<std::array<T, C>, R> data_;
+            if (determinant == T{})
+                return determinant;
+
+            for (size_t i = 0; i < 3; ++i)
+                result.data_[i] = { cofactors[i][0] / determinant, cofactors[i][1] / determinant, cofactors[i][2] / determinant, T{} };
+
+            result.data_[3] = { T{}, T{}, T{}, 1 };
+
+            return determinant;
+        }
+
+        T* Data()
+        {
+            return data_[0].data();
+        }
+
+        const T* Data() const
+        {
+            return data_[0].data();
+        }
+
+        alignas(Storage::Alignment) std::array<std::array<T, C>, R> data_{};
+
+        template <typename, size_t, size_t>
+        friend class Matrix;
 
         template <typename U, size_t R1, size_t C1_R2, size_t C2>
-        friend Matrix<U, R1, C2> operator*(const Matrix<U, R1, C1_R2>& lhs, const Matrix<U, C1_R2, C2>& rhs);
+        friend constexpr Matrix<U, R1, C2> operator*(const Matrix<U, R1, C1_R2>& lhs, const Matrix<U, C1_R2, C2>& rhs);
     };
 
     template <typename T, size_t R1, size_t C1_R2, size_t C2>
-    Matrix<T, R1, C2> operator*(const Matrix<T, R1, C1_R2>& lhs, const Matrix<T, C1_R2, C2>& rhs)
+    constexpr Matrix<T, R1, C2> operator*(const Matrix<T, R1, C1_R2>& lhs, const Matrix<T, C1_R2, C2>& rhs)
     {
         Matrix<T, R1, C2> result;
 
-        std::shared_lock lock1(lhs.mutex_, std::defer_lock);
-        std::shared_lock lock2(rhs.mutex_, std::defer_lock);
-        std::unique_lock lockResult(result.mutex_, std::defer_lock);
+        if constexpr (Matrix<T, R1, C1_R2>::IsSimd && Matrix<T, C1_R2, C2>::IsSimd)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                Simd::MultiplyMatrix(lhs.Data(), rhs.Data(), result.Data());
 
-        std::lock(lock1, lock2, lockResult);
+                return result;
+            }
+        }
 
         for (size_t i = 0; i < R1; ++i)
         {
@@ -618,8 +757,11 @@ namespace Invasion::Math
         return result;
     }
 
+    static_assert(std::is_trivially_copyable_v<Matrix<float, 4, 4>>);
+    static_assert(alignof(Matrix<float, 4, 4>) == 16);
+
     template <typename T, size_t R, size_t C>
-    Matrix<T, R, C> operator*(T scalar, const Matrix<T, R, C>& matrix)
+    constexpr Matrix<T, R, C> operator*(T scalar, const Matrix<T, R, C>& matrix)
     {
         return matrix * scalar;
     }
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "Math/Simd.hpp"
+#include "Math/Vector.hpp"
+
+namespace Invasion::Math
+{
+    class SNorm16x2
+    {
+
+    public:
+
+        SNorm16x2() = default;
+
+        explicit SNorm16x2(const Vector<float, 2>& value) : x(Encode(value[0])), y(Encode(value[1])) { }
+
+        Vector<float, 2> ToVector() const
+        {
+            return { Decode(x), Decode(y) };
+        }
+
+        int16_t GetX() const
+        {
+            return x;
+        }
+
+        int16_t GetY() const
+        {
+            return y;
+        }
+
+        static void Convert(const Vector<float, 2>* source, SNorm16x2* destination, size_t count)
+        {
+            size_t i = 0;
+
+#if INVASION_MATH_SSE
+            const float* input = reinterpret_cast<const float*>(source);
+
+            for (; i < count - count % 4; i += 4)
+            {
+                __m128 scale = _mm_set1_ps(32767.0f);
+
+                __m128i low = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + i * 2), _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f)), scale));
+                __m128i high = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + i * 2 + 4), _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f)), scale));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packs_epi32(low, high));
+            }
+#endif
+
+            for (; i < count; ++i)
+                destination[i] = SNorm16x2(source[i]);
+        }
+
+        static void Convert(const SNorm16x2* source, Vector<float, 2>* destination, size_t count)
+        {
+            size_t i = 0;
+
+#if INVASION_MATH_SSE
+            float* output = reinterpret_cast<float*>(destination);
+
+            for (; i < count - count % 4; i += 4)
+            {
+                __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+                __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+
+                __m128 low = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+                __m128 high = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16));
+
+                _mm_storeu_ps(output + i * 2, _mm_max_ps(_mm_mul_ps(low, scale), _mm_set1_ps(-1.0f)));
+                _mm_storeu_ps(output + i * 2 + 4, _mm_max_ps(_mm_mul_ps(high, scale), _mm_set1_ps(-1.0f)));
+            }
+#endif
+
+            for (; i < count; ++i)
+                destination[i] = source[i].ToVector();
+        }
+
+    private:
+
+        static int16_t Encode(float value)
+        {
+            return static_cast<int16_t>(std::nearbyint(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+        }
+
+        static float Decode(int16_t value)
+        {
+            return std::max(value * (1.0f / 32767.0f), -1.0f);
+        }
+
+        int16_t x;
+        int16_t y;
+
+    };
+
+    class UNorm8x4
+    {
+
+    public:
+
+        UNorm8x4() = default;
+
+        explicit UNorm8x4(const Vector<float, 4>& value) : bits(Encode(value[0]) | Encode(value[1]) << 8 | Encode(value[2]) << 16 | Encode(value[3]) << 24) { }
+
+        Vector<float, 4> ToVector() const
+        {
+            return Vector<float, 4>{ Decode(bits), Decode(bits >> 8), Decode(bits >> 16), Decode(bits >> 24) };
+        }
+
+        uint32_t GetBits() const
+        {
+            return bits;
+        }
+
+        static void Convert(const Vector<float, 4>* source, UNorm8x4* destination, size_t count)
+        {
+            size_t i = 0;
+
+#if INVASION_MATH_SSE
+            const float* input = reinterpret_cast<const float*>(source);
+
+            for (; i < count - count % 4; i += 4)
+            {
+                __m128i lanes[4];
+
+                for (size_t k = 0; k < 4; ++k)
+                    lanes[k] = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_load_ps(input + (i + k) * 4), _mm_setzero_ps()), _mm_set1_ps(1.0f)), _mm_set1_ps(255.0f)));
+
+                __m128i packed = _mm_packus_epi16(_mm_packs_epi32(lanes[0], lanes[1]), _mm_packs_epi32(lanes[2], lanes[3]));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), packed);
+            }
+#endif
+
+            for (; i < count; ++i)
+                destination[i] = UNorm8x4(source[i]);
+        }
+
+        static void Convert(const UNorm8x4* source, Vector<float, 4>* destination, size_t count)
+        {
+            size_t i = 0;
+
+#if INVASION_MATH_SSE
+            float* output = reinterpret_cast<float*>(destination);
+
+            for (; i < count - count % 4; i += 4)
+            {
+                __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+                __m128i low = _mm_unpacklo_epi8(packed, _mm_setzero_si128());
+                __m128i high = _mm_unpackhi_epi8(packed, _mm_setzero_si128());
+
+                __m128i lanes[4] = { _mm_unpacklo_epi16(low, _mm_setzero_si128()), _mm_unpackhi_epi16(low, _mm_setzero_si128()), _mm_unpacklo_epi16(high, _mm_setzero_si128()), _mm_unpackhi_epi16(high, _mm_setzero_si128()) };
+
+                for (size_t k = 0; k < 4; ++k)
+                    _mm_store_ps(output + (i + k) * 4, _mm_mul_ps(_mm_cvtepi32_ps(lanes[k]), _mm_set1_ps(1.0f / 255.0f)));
+            }
+#endif
+
+            for (; i < count; ++i)
+                destination[i] = source[i].ToVector();
+        }
+
+    private:
+
+        static uint32_t Encode(float value)
+        {
+            return static_cast<uint32_t>(std::nearbyint(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+        }
+
+        static float Decode(uint32_t value)
+        {
+            return static_cast<float>(value & 0xFFu) * (1.0f / 255.0f);
+        }
+
+        uint32_t bits;
+
+    };
+
+    class OctahedralNormal
+    {
+
+    public:
+
+        OctahedralNormal() = default;
+
+        explicit OctahedralNormal(const Vector<float, 3>& normal)
+        {
+            Vector<float, 3> projected = normal / (std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]));
+
+            Vector<float, 2> folded = { projected[0], projected[1] };
+
+            if (projected[2] < 0.0f)
+                folded = { (1.0f - std::abs(projected[1])) * SignOf(projected[0]), (1.0f - std::abs(projected[0])) * SignOf(projected[1]) };
+
+            encoded = SNorm16x2(folded);
+        }
+
+        Vector<float, 3> ToVector() const
+        {
+            Vector<float, 2> folded = encoded.ToVector();
+
+            Vector<float, 3> normal = { folded[0], folded[1], 1.0f - std::abs(folded[0]) - std::abs(folded[1]) };
+
+            float shift = std::max(-normal[2], 0.0f);
+
+            normal[0] += normal[0] >= 0.0f ? -shift : shift;
+            normal[1] += normal[1] >= 0.0f ? -shift : shift;
+
+            return normal.Normalize();
+        }
+
+        const SNorm16x2& GetEncoded() const
+        {
+            return encoded;
+        }
+
+    private:
+
+        static float SignOf(float value)
+        {
+            return value >= 0.0f ? 1.0f : -1.0f;
+        }
+
+        SNorm16x2 encoded;
+
+    };
+
+    static_assert(sizeof(SNorm16x2) == 4 && sizeof(UNorm8x4) == 4 && sizeof(OctahedralNormal) == 4);
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include "Math/AABB.hpp"
+#include "Math/Quaternion.hpp"
+
+namespace Invasion::Math
+{
+    class OBB
+    {
+
+    public:
+
+        OBB() : center{ 0.0f, 0.0f, 0.0f }, extents{ 0.0f, 0.0f, 0.0f }, axes{ Vector<float, 3>{ 1.0f, 0.0f, 0.0f }, Vector<float, 3>{ 0.0f, 1.0f, 0.0f }, Vector<float, 3>{ 0.0f, 0.0f, 1.0f } } { }
+
+        OBB(const Vector<float, 3>& center, const Vector<float, 3>& extents, const Quaternion<float>& orientation) : center(center), extents(extents)
+        {
+            axes[0] = orientation.Rotate({ 1.0f, 0.0f, 0.0f });
+            axes[1] = orientation.Rotate({ 0.0f, 1.0f, 0.0f });
+            axes[2] = orientation.Rotate({ 0.0f, 0.0f, 1.0f });
+        }
+
+        const Vector<float, 3>& GetCenter() const
+        {
+            return center;
+        }
+
+        const Vector<float, 3>& GetExtents() const
+        {
+            return extents;
+        }
+
+        const Vector<float, 3>& GetAxis(size_t index) const
+        {
+            return axes[index];
+        }
+
+        std::array<Vector<float, 3>, 8> GetCorners() const
+        {
+            std::array<Vector<float, 3>, 8> corners;
+
+            for (size_t i = 0; i < 8; ++i)
+                corners[i] = center + axes[0] * (i & 1 ? extents[0] : -extents[0]) + axes[1] * (i & 2 ? extents[1] : -extents[1]) + axes[2] * (i & 4 ? extents[2] : -extents[2]);
+
+            return corners;
+        }
+
+        float ProjectExtents(const Vector<float, 3>& axis) const
+        {
+            return extents[0] * std::abs(Vector<float, 3>::Dot(axes[0], axis)) + extents[1] * std::abs(Vector<float, 3>::Dot(axes[1], axis)) + extents[2] * std::abs(Vector<float, 3>::Dot(axes[2], axis));
+        }
+
+        bool Contains(const Vector<float, 3>& point) const
+        {
+            Vector<float, 3> offset = point - center;
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (std::abs(Vector<float, 3>::Dot(offset, axes[i])) > extents[i])
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool Intersects(const OBB& other) const
+        {
+            Vector<float, 3> offset = other.center - center;
+
+            auto separates = [&](const Vector<float, 3>& axis)
+            {
+                return std::abs(Vector<float, 3>::Dot(offset, axis)) > ProjectExtents(axis) + other.ProjectExtents(axis);
+            };
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (separates(axes[i]) || separates(other.axes[i]))
+                    return false;
+            }
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                for (size_t j = 0; j < 3; ++j)
+                {
+                    Vector<float, 3> axis = Vector<float, 3>::Cross(axes[i], other.axes[j]);
+
+                    if (axis.LengthSquared() > 1e-6f && separates(axis))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool Intersects(const AABB& box) const
+        {
+            return Intersects(FromAABB(box));
+        }
+
+        OBB Transform(const Matrix<float, 4, 4>& matrix) const
+        {
+            OBB result;
+
+            result.center = matrix.TransformPoint(center);
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                Vector<float, 3> axis = matrix.TransformVector(axes[i]);
+
+                float length = axis.Length();
+
+                result.axes[i] = axis / length;
+                result.extents[i] = extents[i] * length;
+            }
+
+            return result;
+        }
+
+        AABB ToAABB() const
+        {
+            Vector<float, 3> reach = axes[0].Abs() * extents[0] + axes[1].Abs() * extents[1] + axes[2].Abs() * extents[2];
+
+            return AABB::FromCenterExtents(center, reach);
+        }
+
+        static OBB FromAABB(const AABB& box)
+        {
+            return { box.GetCenter(), box.GetExtents(), Quaternion<float>::Identity() };
+        }
+
+    private:
+
+        Vector<float, 3> center;
+        Vector<float, 3> extents;
+
+        std::array<Vector<float, 3>, 3> axes;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Math/Matrix.hpp"
+
+namespace Invasion::Math
+{
+    class Plane
+    {
+
+    public:
+
+        Plane() : normal{ 0.0f, 1.0f, 0.0f }, distance(0.0f) { }
+
+        Plane(const Vector<float, 3>& normal, float distance) : normal(normal), distance(distance) { }
+
+        const Vector<float, 3>& GetNormal() const
+        {
+            return normal;
+        }
+
+        float GetDistance() const
+        {
+            return distance;
+        }
+
+        float DistanceTo(const Vector<float, 3>& point) const
+        {
+            return Vector<float, 3>::Dot(normal, point) + distance;
+        }
+
+        Vector<float, 3> Project(const Vector<float, 3>& point) const
+        {
+            return point - normal * DistanceTo(point);
+        }
+
+        Plane Normalize() const
+        {
+            float length = normal.Length();
+
+            return { normal / length, distance / length };
+        }
+
+        Plane Transform(const Matrix<float, 4, 4>& matrix) const
+        {
+            Plane normalized = Normalize();
+
+            Vector<float, 3> point = matrix.TransformPoint(normalized.normal * -normalized.distance);
+
+            return FromNormalPoint(matrix.InverseTranspose().TransformVector(normalized.normal), point);
+        }
+
+        static Plane FromNormalPoint(const Vector<float, 3>& normal, const Vector<float, 3>& point)
+        {
+            Vector<float, 3> unit = normal.Normalize();
+
+            return { unit, -Vector<float, 3>::Dot(unit, point) };
+        }
+
+        static Plane FromPoints(const Vector<float, 3>& a, const Vector<float, 3>& b, const Vector<float, 3>& c)
+        {
+            return FromNormalPoint(Vector<float, 3>::Cross(b - a, c - a), a);
+        }
+
+    private:
+
+        Vector<float, 3> normal;
+        float distance;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+namespace Invasion::Math
+{
+    template <Arithmetic T>
+    class Quaternion
+    {
+
+    public:
+
+        Quaternion() : data{ 0, 0, 0, 1 } { }
+
+        Quaternion(T x, T y, T z, T w) : data{ x, y, z, w } { }
+
+        explicit Quaternion(const Vector<T, 4>& data) : data(data) { }
+
+        T GetX() const
+        {
+            return data[0];
+        }
+
+        T GetY() const
+        {
+            return data[1];
+        }
+
+        T GetZ() const
+        {
+            return data[2];
+        }
+
+        T GetW() const
+        {
+            return data[3];
+        }
+
+        const Vector<T, 4>& GetVector() const
+        {
+            return data;
+        }
+
+        Quaternion operator*(const Quaternion& other) const
+        {
+            const T x = data[0], y = data[1], z = data[2], w = data[3];
+            const T ox = other.data[0], oy = other.data[1], oz = other.data[2], ow = other.data[3];
+
+            return
+            {
+                w * ox + x * ow + y * oz - z * oy,
+                w * oy - x * oz + y * ow + z * ox,
+                w * oz + x * oy - y * ox + z * ow,
+                w * ow - x * ox - y * oy - z * oz
+            };
+        }
+
+        Quaternion& operator*=(const Quaternion& other)
+        {
+            return *this = *this * other;
+        }
+
+        bool operator==(const Quaternion& other) const
+        {
+            return data == other.data;
+        }
+
+        bool operator!=(const Quaternion& other) const
+        {
+            return !(*this == other);
+        }
+
+        Quaternion Conjugate() const
+        {
+            return { -data[0], -data[1], -data[2], data[3] };
+        }
+
+        Quaternion Inverse() const
+        {
+            return Quaternion(Conjugate().data / LengthSquared());
+        }
+
+        Quaternion Normalize() const
+        {
+            return Quaternion(data.Normalize());
+        }
+
+        T Length() const
+        {
+            return data.Length();
+        }
+
+        T LengthSquared() const
+        {
+            return data.LengthSquared();
+        }
+
+        static T Dot(const Quaternion& a, const Quaternion& b)
+        {
+            return Vector<T, 4>::Dot(a.data, b.data);
+        }
+
+        Vector<T, 3> Rotate(const Vector<T, 3>& vector) const
+        {
+            Vector<T, 3> axis = { data[0], data[1], data[2] };
+            Vector<T, 3> twice = Vector<T, 3>::Cross(axis, vector) * static_cast<T>(2);
+
+            return vector + twice * data[3] + Vector<T, 3>::Cross(axis, twice);
+        }
+
+        Matrix<T, 4, 4> ToMatrix() const
+        {
+            const T x = data[0], y = data[1], z = data[2], w = data[3];
+
+            return
+            {
+                { 1 - 2 * (y * y + z * z), 2 * (x * y + w * z), 2 * (x * z - w * y), 0 },
+                { 2 * (x * y - w * z), 1 - 2 * (x * x + z * z), 2 * (y * z + w * x), 0 },
+                { 2 * (x * z + w * y), 2 * (y * z - w * x), 1 - 2 * (x * x + y * y), 0 },
+                { 0, 0, 0, 1 }
+            };
+        }
+
+        Vector<T, 3> ToEuler() const
+        {
+            const T x = data[0], y = data[1], z = data[2], w = data[3];
+
+            T sinY = std::clamp(2 * (x * z + w * y), static_cast<T>(-1), static_cast<T>(1));
+
+            Vector<T, 3> radians;
+
+            radians[1] = Scalar::Asin(sinY);
+
+            if (std::abs(sinY) < static_cast<T>(0.9999995))
+            {
+                radians[0] = Scalar::Atan2(-2 * (y * z - w * x), 1 - 2 * (x * x + y * y));
+                radians[2] = Scalar::Atan2(-2 * (x * y - w * z), 1 - 2 * (y * y + z * z));
+            }
+            else
+            {
+                radians[0] = Scalar::Atan2(2 * (y * z + w * x), 1 - 2 * (x * x + z * z));
+                radians[2] = 0;
+            }
+
+            return radians * (static_cast<T>(180) / std::numbers::pi_v<T>);
+        }
+
+        static Quaternion Identity()
+        {
+            return {};
+        }
+
+        static Quaternion AxisAngle(const Vector<T, 3>& axis, T angle)
+        {
+            T sine{}, cosine{};
+
+            Scalar::SinCos(angle * (std::numbers::pi_v<T> / 360), sine, cosine);
+
+            Vector<T, 3> scaled = axis.Normalize() * sine;
+
+            return { scaled[0], scaled[1], scaled[2], cosine };
+        }
+
+        static Quaternion FromEuler(const Vector<T, 3>& angles)
+        {
+            Vector<T, 3> sine, cosine;
+
+            Vector<T, 3>::SinCos(angles * (std::numbers::pi_v<T> / 360), sine, cosine);
+
+            Quaternion x = { sine[0], 0, 0, cosine[0] };
+            Quaternion y = { 0, sine[1], 0, cosine[1] };
+            Quaternion z = { 0, 0, sine[2], cosine[2] };
+
+            return x * y * z;
+        }
+
+        static Quaternion Slerp(const Quaternion& a, const Quaternion& b, T t)
+        {
+            T cosTheta = Dot(a, b);
+            Vector<T, 4> target = b.data;
+
+            if (cosTheta < 0)
+            {
+                cosTheta = -cosTheta;
+                target = target * static_cast<T>(-1);
+            }
+
+            if (cosTheta > static_cast<T>(0.9995))
+                return Quaternion(Vector<T, 4>::Lerp(a.data, target, t)).Normalize();
+
+            T theta = std::acos(cosTheta);
+            T sinTheta = std::sin(theta);
+
+            return Quaternion(a.data * (std::sin((1 - t) * theta) / sinTheta) + target * (std::sin(t * theta) / sinTheta));
+        }
+
+    private:
+
+        Vector<T, 4> data;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "Math/AABB.hpp"
+#include "Math/BoundingSphere.hpp"
+#include "Math/OBB.hpp"
+#include "Math/Plane.hpp"
+
+namespace Invasion::Math
+{
+    class Ray
+    {
+
+    public:
+
+        Ray() : origin{ 0.0f, 0.0f, 0.0f }, direction{ 0.0f, 0.0f, 1.0f } { }
+
+        Ray(const Vector<float, 3>& origin, const Vector<float, 3>& direction) : origin(origin), direction(direction.Normalize()) { }
+
+        const Vector<float, 3>& GetOrigin() const
+        {
+            return origin;
+        }
+
+        const Vector<float, 3>& GetDirection() const
+        {
+            return direction;
+        }
+
+        Vector<float, 3> GetPoint(float distance) const
+        {
+            return origin + direction * distance;
+        }
+
+        bool Intersects(const AABB& box, float& distance) const
+        {
+            Vector<float, 3> inverse = Vector<float, 3>(1.0f) / direction;
+
+            Vector<float, 3> first = (box.GetMin() - origin) * inverse;
+            Vector<float, 3> second = (box.GetMax() - origin) * inverse;
+
+            Vector<float, 3> nearest = Vector<float, 3>::Min(first, second);
+            Vector<float, 3> farthest = Vector<float, 3>::Max(first, second);
+
+            float enter = std::max({ nearest[0], nearest[1], nearest[2] });
+            float exit = std::min({ farthest[0], farthest[1], farthest[2] });
+
+            if (exit < std::max(enter, 0.0f))
+                return false;
+
+            distance = std::max(enter, 0.0f);
+
+            return true;
+        }
+
+        bool Intersects(const OBB& box, float& distance) const
+        {
+            Vector<float, 3> offset = origin - box.GetCenter();
+
+            Vector<float, 3> localOrigin = { Vector<float, 3>::Dot(offset, box.GetAxis(0)), Vector<float, 3>::Dot(offset, box.GetAxis(1)), Vector<float, 3>::Dot(offset, box.GetAxis(2)) };
+            Vector<float, 3> localDirection = { Vector<float, 3>::Dot(direction, box.GetAxis(0)), Vector<float, 3>::Dot(direction, box.GetAxis(1)), Vector<float, 3>::Dot(direction, box.GetAxis(2)) };
+
+            Ray local;
+
+            local.origin = localOrigin;
+            local.direction = localDirection;
+
+            return local.Intersects(AABB(box.GetExtents() * -1.0f, box.GetExtents()), distance);
+        }
+
+        bool Intersects(const BoundingSphere& sphere, float& distance) const
+        {
+            Vector<float, 3> offset = origin - sphere.GetCenter();
+
+            float b = Vector<float, 3>::Dot(offset, direction);
+            float c = offset.LengthSquared() - sphere.GetRadius() * sphere.GetRadius();
+
+            if (c > 0.0f && b > 0.0f)
+                return false;
+
+            float discriminant = b * b - c;
+
+            if (discriminant < 0.0f)
+                return false;
+
+            distance = std::max(-b - std::sqrt(discriminant), 0.0f);
+
+            return true;
+        }
+
+        bool Intersects(const Plane& plane, float& distance) const
+        {
+            float denominator = Vector<float, 3>::Dot(plane.GetNormal(), direction);
+
+            if (std::abs(denominator) < 1e-6f)
+                return false;
+
+            float t = -plane.DistanceTo(origin) / denominator;
+
+            if (t < 0.0f)
+                return false;
+
+            distance = t;
+
+            return true;
+        }
+
+        Ray Transform(const Matrix<float, 4, 4>& matrix) const
+        {
+            return { matrix.TransformPoint(origin), matrix.TransformVector(direction) };
+        }
+
+    private:
+
+        Vector<float, 3> origin;
+        Vector<float, 3> direction;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace Invasion::Math
+{
+    class Scalar
+    {
+
+    public:
+
+        Scalar() = delete;
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr T Abs(T value)
+        {
+            return value < 0 ? -value : value;
+        }
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr T Sqrt(T value)
+        {
+            if (!std::is_constant_evaluated())
+                return static_cast<T>(std::sqrt(value));
+
+            if (value != value || value < 0)
+                return std::numeric_limits<T>::quiet_NaN();
+
+            if (value == 0 || value == std::numeric_limits<T>::infinity())
+                return value;
+
+            long double target = value;
+            long double estimate = target > 1 ? target : 1.0L;
+
+            for (int i = 0; i < 128; ++i)
+            {
+                long double next = (estimate + target / estimate) / 2;
+
+                if (next == estimate)
+                    break;
+
+                estimate = next;
+            }
+
+            return static_cast<T>(estimate);
+        }
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr T Sin(T angle)
+        {
+            if (!std::is_constant_evaluated())
+                return static_cast<T>(std::sin(angle));
+
+            long double x = Reduce(angle);
+            long double term = x;
+            long double sum = x;
+
+            for (int i = 1; i < 16; ++i)
+            {
+                term *= -x * x / ((2 * i) * (2 * i + 1));
+                sum += term;
+            }
+
+            return static_cast<T>(sum);
+        }
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr T Cos(T angle)
+        {
+            if (!std::is_constant_evaluated())
+                return static_cast<T>(std::cos(angle));
+
+            long double x = Reduce(angle);
+            long double term = 1;
+            long double sum = 1;
+
+            for (int i = 1; i < 16; ++i)
+            {
+                term *= -x * x / ((2 * i - 1) * (2 * i));
+                sum += term;
+            }
+
+            return static_cast<T>(sum);
+        }
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr T Tan(T angle)
+        {
+            if (!std::is_constant_evaluated())
+                return static_cast<T>(std::tan(angle));
+
+            return Sin(angle) / Cos(angle);
+        }
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr void SinCos(T angle, T& sine, T& cosine)
+        {
+#ifdef INVASION_MATH_FAST_TRIG
+            if (!std::is_constant_evaluated())
+            {
+                FastSinCos(angle, sine, cosine);
+
+                return;
+            }
+#endif
+            sine = Sin(angle);
+            cosine = Cos(angle);
+        }
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr T Asin(T value)
+        {
+#ifndef INVASION_MATH_FAST_TRIG
+            if (!std::is_constant_evaluated())
+                return static_cast<T>(std::asin(value));
+#endif
+            return FastAsin(value);
+        }
+
+        template <typename T> requires std::is_arithmetic_v<T>
+        static constexpr T Atan2(T y, T x)
+        {
+#ifndef INVASION_MATH_FAST_TRIG
+            if (!std::is_constant_evaluated())
+                return static_cast<T>(std::atan2(y, x));
+#endif
+            return FastAtan2(y, x);
+        }
+
+        // Max absolute error 9.2e-8 for |angle| <= 1e4; grows with |angle| beyond that as the range reduction loses bits.
+        template <typename T> requires std::is_floating_point_v<T>
+        static constexpr void FastSinCos(T angle, T& sine, T& cosine)
+        {
+            long long quadrant = static_cast<long long>(angle * static_cast<T>(0.636619772367581343) + (angle < 0 ? static_cast<T>(-0.5) : static_cast<T>(0.5)));
+            T whole = static_cast<T>(quadrant);
+
+            T x = ((angle - whole * static_cast<T>(1.5703125)) - whole * static_cast<T>(4.837512969970703125e-4)) - whole * static_cast<T>(7.54978995489188216e-8);
+            T x2 = x * x;
+
+            T s = x + x * x2 * (static_cast<T>(-1.6666654611e-1) + x2 * (static_cast<T>(8.3321608736e-3) + x2 * static_cast<T>(-1.9515295891e-4)));
+            T c = 1 - x2 / 2 + x2 * x2 * (static_cast<T>(4.166664568298827e-2) + x2 * (static_cast<T>(-1.388731625493765e-3) + x2 * static_cast<T>(2.443315711809948e-5)));
+
+            bool swap = quadrant & 1;
+
+            sine = (swap ? c : s) * static_cast<T>(1 - (quadrant & 2));
+            cosine = (swap ? s : c) * static_cast<T>(1 - ((quadrant + 1) & 2));
+        }
+
+        // Max absolute error 2.7e-7 over [-1, 1]; NaN outside it.
+        template <typename T> requires std::is_floating_point_v<T>
+        static constexpr T FastAsin(T value)
+        {
+            T x = Abs(value);
+
+            if (x > 1)
+                return std::numeric_limits<T>::quiet_NaN();
+
+            T polynomial = static_cast<T>(-0.0012624911);
+
+            polynomial = polynomial * x + static_cast<T>(0.0066700901);
+            polynomial = polynomial * x - static_cast<T>(0.0170881256);
+            polynomial = polynomial * x + static_cast<T>(0.0308918810);
+            polynomial = polynomial * x - static_cast<T>(0.0501743046);
+            polynomial = polynomial * x + static_cast<T>(0.0889789874);
+            polynomial = polynomial * x - static_cast<T>(0.2145988016);
+            polynomial = polynomial * x + static_cast<T>(1.5707963050);
+
+            T result = static_cast<T>(Pi / 2) - Sqrt(1 - x) * polynomial;
+
+            return value < 0 ? -result : result;
+        }
+
+        // Max absolute error 2.0e-6 rad; FastAtan2(0, 0) is 0.
+        template <typename T> requires std::is_floating_point_v<T>
+        static constexpr T FastAtan2(T y, T x)
+        {
+            T absoluteX = Abs(x);
+            T absoluteY = Abs(y);
+
+            if (absoluteX == 0 && absoluteY == 0)
+                return 0;
+
+            T z = absoluteX > absoluteY ? absoluteY / absoluteX : absoluteX / absoluteY;
+            T z2 = z * z;
+
+            T result = z * (static_cast<T>(0.99997726) + z2 * (static_cast<T>(-0.33262347) + z2 * (static_cast<T>(0.19354346) + z2 * (static_cast<T>(-0.11643287) + z2 * (static_cast<T>(0.05265332) + z2 * static_cast<T>(-0.01172120))))));
+
+            if (absoluteY > absoluteX)
+                result = static_cast<T>(Pi / 2) - result;
+
+            if (x < 0)
+                result = static_cast<T>(Pi) - result;
+
+            return y < 0 ? -result : result;
+        }
+
+    private:
+
+        static constexpr long double Pi = 3.141592653589793238462643383279502884L;
+
+        static constexpr long double Reduce(long double angle)
+        {
+            long double turns = angle / (2 * Pi);
+            long long whole = static_cast<long long>(turns + (turns >= 0 ? 0.5L : -0.5L));
+
+            return angle - static_cast<long double>(whole) * (2 * Pi);
+        }
+
+    };
+}
\ No newline at end of file
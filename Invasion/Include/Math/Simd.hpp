@@ -0,0 +1,731 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include "Math/Scalar.hpp"
+
+#if !defined(INVASION_MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define INVASION_MATH_SSE 1
+#include <emmintrin.h>
+#if defined(__AVX__)
+#define INVASION_MATH_AVX 1
+#include <immintrin.h>
+#else
+#define INVASION_MATH_AVX 0
+#endif
+#if defined(__AVX2__)
+#define INVASION_MATH_AVX2 1
+#else
+#define INVASION_MATH_AVX2 0
+#endif
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define INVASION_MATH_F16C 1
+#else
+#define INVASION_MATH_F16C 0
+#endif
+#else
+#define INVASION_MATH_AVX 0
+#define INVASION_MATH_AVX2 0
+#define INVASION_MATH_F16C 0
+#define INVASION_MATH_SSE 0
+#endif
+
+namespace Invasion::Math::Simd
+{
+#if INVASION_MATH_SSE
+
+    using Float4 = __m128;
+
+    inline Float4 LaneMask(size_t count)
+    {
+        alignas(16) static constexpr int masks[5][4] =
+        {
+            {  0,  0,  0,  0 },
+            { -1,  0,  0,  0 },
+            { -1, -1,  0,  0 },
+            { -1, -1, -1,  0 },
+            { -1, -1, -1, -1 }
+        };
+
+        return _mm_load_ps(reinterpret_cast<const float*>(masks[count]));
+    }
+
+    template <size_t N> requires (N >= 2 && N <= 4)
+    inline Float4 Load(const float* source)
+    {
+        if constexpr (N == 2)
+            return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(source)));
+        else
+            return _mm_load_ps(source);
+    }
+
+    template <size_t N> requires (N >= 2 && N <= 4)
+    inline void Store(float* destination, Float4 value)
+    {
+        if constexpr (N == 2)
+            _mm_store_sd(reinterpret_cast<double*>(destination), _mm_castps_pd(value));
+        else if constexpr (N == 3)
+            _mm_store_ps(destination, _mm_and_ps(value, LaneMask(3)));
+        else
+            _mm_store_ps(destination, value);
+    }
+
+    inline Float4 Splat(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    inline Float4 Add(Float4 a, Float4 b)
+    {
+        return _mm_add_ps(a, b);
+    }
+
+    inline Float4 Subtract(Float4 a, Float4 b)
+    {
+        return _mm_sub_ps(a, b);
+    }
+
+    inline Float4 Multiply(Float4 a, Float4 b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    inline Float4 Divide(Float4 a, Float4 b)
+    {
+        return _mm_div_ps(a, b);
+    }
+
+    inline Float4 MultiplyAdd(Float4 a, Float4 b, Float4 c)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+
+    inline Float4 Min(Float4 a, Float4 b)
+    {
+        return _mm_min_ps(a, b);
+    }
+
+    inline Float4 Max(Float4 a, Float4 b)
+    {
+        return _mm_max_ps(a, b);
+    }
+
+    inline Float4 Abs(Float4 value)
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+    }
+
+    inline Float4 Sqrt(Float4 value)
+    {
+        return _mm_sqrt_ps(value);
+    }
+
+    inline float Dot(Float4 a, Float4 b)
+    {
+        Float4 product = _mm_mul_ps(a, b);
+        Float4 sum = _mm_add_ps(product, _mm_movehl_ps(product, product));
+
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+
+        return _mm_cvtss_f32(sum);
+    }
+
+    inline Float4 Cross(Float4 a, Float4 b)
+    {
+        Float4 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        Float4 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        Float4 result = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+
+        return _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+    inline bool Equal(Float4 a, Float4 b, size_t count)
+    {
+        int mask = (1 << count) - 1;
+
+        return (_mm_movemask_ps(_mm_cmpeq_ps(a, b)) & mask) == mask;
+    }
+
+    template <int X, int Y, int Z, int W>
+    inline Float4 Shuffle(Float4 a, Float4 b)
+    {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+    template <int X, int Y, int Z, int W>
+    inline Float4 Swizzle(Float4 value)
+    {
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+    inline Float4 SumAcross(Float4 value)
+    {
+        Float4 sum = _mm_add_ps(value, _mm_movehl_ps(value, value));
+
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+
+        return Swizzle<0, 0, 0, 0>(sum);
+    }
+
+    struct Float4x4
+    {
+        Float4 rows[4];
+    };
+
+    inline Float4x4 LoadMatrix(const float* source)
+    {
+        return { _mm_load_ps(source), _mm_load_ps(source + 4), _mm_load_ps(source + 8), _mm_load_ps(source + 12) };
+    }
+
+    inline void StoreMatrix(float* destination, const Float4x4& matrix)
+    {
+        for (int i = 0; i < 4; ++i)
+            _mm_store_ps(destination + i * 4, matrix.rows[i]);
+    }
+
+    inline Float4 TransformRow(Float4 row, const Float4x4& matrix)
+    {
+        Float4 result = _mm_mul_ps(Swizzle<0, 0, 0, 0>(row), matrix.rows[0]);
+
+        result = _mm_add_ps(result, _mm_mul_ps(Swizzle<1, 1, 1, 1>(row), matrix.rows[1]));
+        result = _mm_add_ps(result, _mm_mul_ps(Swizzle<2, 2, 2, 2>(row), matrix.rows[2]));
+        result = _mm_add_ps(result, _mm_mul_ps(Swizzle<3, 3, 3, 3>(row), matrix.rows[3]));
+
+        return result;
+    }
+
+    inline void MultiplyMatrix(const float* a, const float* b, float* result)
+    {
+#if INVASION_MATH_AVX
+        __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b));
+        __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+        __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+        __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+
+        for (int i = 0; i < 16; i += 8)
+        {
+            __m256 rows = _mm256_loadu_ps(a + i);
+            __m256 sum = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x00), b0);
+
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x55), b1));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xAA), b2));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xFF), b3));
+
+            _mm256_storeu_ps(result + i, sum);
+        }
+#else
+        Float4x4 right = LoadMatrix(b);
+
+        for (int i = 0; i < 16; i += 4)
+            _mm_store_ps(result + i, TransformRow(_mm_load_ps(a + i), right));
+#endif
+    }
+
+    inline void TransposeMatrix(const float* source, float* result)
+    {
+        Float4x4 matrix = LoadMatrix(source);
+
+        _MM_TRANSPOSE4_PS(matrix.rows[0], matrix.rows[1], matrix.rows[2], matrix.rows[3]);
+
+        StoreMatrix(result, matrix);
+    }
+
+    inline Float4 Matrix2Multiply(Float4 a, Float4 b)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+    }
+
+    inline Float4 Matrix2AdjugateMultiply(Float4 a, Float4 b)
+    {
+        return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+    }
+
+    inline Float4 Matrix2MultiplyAdjugate(Float4 a, Float4 b)
+    {
+        return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+    }
+
+    inline float InverseMatrix(const float* source, float* result)
+    {
+        Float4x4 m = LoadMatrix(source);
+
+        Float4 a = _mm_movelh_ps(m.rows[0], m.rows[1]);
+        Float4 b = _mm_movehl_ps(m.rows[1], m.rows[0]);
+        Float4 c = _mm_movelh_ps(m.rows[2], m.rows[3]);
+        Float4 d = _mm_movehl_ps(m.rows[3], m.rows[2]);
+
+        Float4 subDeterminants = _mm_sub_ps(
+            _mm_mul_ps(Shuffle<0, 2, 0, 2>(m.rows[0], m.rows[2]), Shuffle<1, 3, 1, 3>(m.rows[1], m.rows[3])),
+            _mm_mul_ps(Shuffle<1, 3, 1, 3>(m.rows[0], m.rows[2]), Shuffle<0, 2, 0, 2>(m.rows[1], m.rows[3])));
+
+        Float4 determinantA = Swizzle<0, 0, 0, 0>(subDeterminants);
+        Float4 determinantB = Swizzle<1, 1, 1, 1>(subDeterminants);
+        Float4 determinantC = Swizzle<2, 2, 2, 2>(subDeterminants);
+        Float4 determinantD = Swizzle<3, 3, 3, 3>(subDeterminants);
+
+        Float4 dc = Matrix2AdjugateMultiply(d, c);
+        Float4 ab = Matrix2AdjugateMultiply(a, b);
+
+        Float4 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), Matrix2Multiply(b, dc));
+        Float4 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), Matrix2Multiply(c, ab));
+        Float4 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), Matrix2MultiplyAdjugate(d, ab));
+        Float4 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), Matrix2MultiplyAdjugate(a, dc));
+
+        Float4 determinant = _mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC));
+
+        determinant = _mm_sub_ps(determinant, SumAcross(_mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc))));
+
+        float scalar = _mm_cvtss_f32(determinant);
+
+        if (scalar == 0.0f)
+            return scalar;
+
+        Float4 reciprocal = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+
+        x = _mm_mul_ps(x, reciprocal);
+        y = _mm_mul_ps(y, reciprocal);
+        z = _mm_mul_ps(z, reciprocal);
+        w = _mm_mul_ps(w, reciprocal);
+
+        StoreMatrix(result, { Shuffle<3, 1, 3, 1>(x, y), Shuffle<2, 0, 2, 0>(x, y), Shuffle<3, 1, 3, 1>(z, w), Shuffle<2, 0, 2, 0>(z, w) });
+
+        return scalar;
+    }
+
+    inline float AffineInverseMatrix(const float* source, float* result)
+    {
+        Float4x4 m = LoadMatrix(source);
+
+        Float4 mask = LaneMask(3);
+
+        Float4 row0 = _mm_and_ps(m.rows[0], mask);
+        Float4 row1 = _mm_and_ps(m.rows[1], mask);
+        Float4 row2 = _mm_and_ps(m.rows[2], mask);
+
+        Float4 column0 = Cross(row1, row2);
+        Float4 column1 = Cross(row2, row0);
+        Float4 column2 = Cross(row0, row1);
+
+        float determinant = Dot(row0, column0);
+
+        if (determinant == 0.0f)
+            return determinant;
+
+        Float4 reciprocal = _mm_set1_ps(1.0f / determinant);
+        Float4 row3 = _mm_setzero_ps();
+
+        column0 = _mm_mul_ps(column0, reciprocal);
+        column1 = _mm_mul_ps(column1, reciprocal);
+        column2 = _mm_mul_ps(column2, reciprocal);
+
+        _MM_TRANSPOSE4_PS(column0, column1, column2, row3);
+
+        Float4 translation = _mm_and_ps(m.rows[3], mask);
+
+        row3 = _mm_mul_ps(Swizzle<0, 0, 0, 0>(translation), column0);
+        row3 = _mm_add_ps(row3, _mm_mul_ps(Swizzle<1, 1, 1, 1>(translation), column1));
+        row3 = _mm_add_ps(row3, _mm_mul_ps(Swizzle<2, 2, 2, 2>(translation), column2));
+        row3 = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), row3);
+
+        StoreMatrix(result, { column0, column1, column2, row3 });
+
+        return determinant;
+    }
+
+    inline float InverseTransposeMatrix(const float* source, float* result)
+    {
+        Float4x4 m = LoadMatrix(source);
+
+        Float4 mask = LaneMask(3);
+
+        Float4 row0 = _mm_and_ps(m.rows[0], mask);
+        Float4 row1 = _mm_and_ps(m.rows[1], mask);
+        Float4 row2 = _mm_and_ps(m.rows[2], mask);
+
+        Float4 cofactor0 = Cross(row1, row2);
+
+        float determinant = Dot(row0, cofactor0);
+
+        if (determinant == 0.0f)
+            return determinant;
+
+        Float4 reciprocal = _mm_set1_ps(1.0f / determinant);
+
+        StoreMatrix(result, { _mm_mul_ps(cofactor0, reciprocal), _mm_mul_ps(Cross(row2, row0), reciprocal), _mm_mul_ps(Cross(row0, row1), reciprocal), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f) });
+
+        return determinant;
+    }
+
+    // Same polynomial and bound as Scalar::FastSinCos: 9.2e-8 for |angle| <= 1e4.
+    inline void SinCos4(Float4 angles, Float4& sine, Float4& cosine)
+    {
+        __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(angles, _mm_set1_ps(0.636619772f)));
+        Float4 whole = _mm_cvtepi32_ps(quadrant);
+
+        Float4 x = _mm_sub_ps(angles, _mm_mul_ps(whole, _mm_set1_ps(1.5703125f)));
+        x = _mm_sub_ps(x, _mm_mul_ps(whole, _mm_set1_ps(4.837512969970703125e-4f)));
+        x = _mm_sub_ps(x, _mm_mul_ps(whole, _mm_set1_ps(7.54978995489188216e-8f)));
+
+        Float4 x2 = _mm_mul_ps(x, x);
+
+        Float4 s = _mm_add_ps(_mm_mul_ps(x2, _mm_set1_ps(-1.9515295891e-4f)), _mm_set1_ps(8.3321608736e-3f));
+        s = _mm_add_ps(_mm_mul_ps(x2, s), _mm_set1_ps(-1.6666654611e-1f));
+        s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x2, x), s), x);
+
+        Float4 c = _mm_add_ps(_mm_mul_ps(x2, _mm_set1_ps(2.443315711809948e-5f)), _mm_set1_ps(-1.388731625493765e-3f));
+        c = _mm_add_ps(_mm_mul_ps(x2, c), _mm_set1_ps(4.166664568298827e-2f));
+        c = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x2, x2), c), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, _mm_set1_ps(0.5f))));
+
+        __m128i one = _mm_set1_epi32(1);
+        __m128i two = _mm_set1_epi32(2);
+
+        Float4 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+
+        sine = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+        cosine = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+        sine = _mm_xor_ps(sine, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30)));
+        cosine = _mm_xor_ps(cosine, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30)));
+    }
+
+#if INVASION_MATH_AVX2
+
+    // Same polynomial and bound as Scalar::FastSinCos: 9.2e-8 for |angle| <= 1e4.
+    inline void SinCos8(__m256 angles, __m256& sine, __m256& cosine)
+    {
+        __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(angles, _mm256_set1_ps(0.636619772f)));
+        __m256 whole = _mm256_cvtepi32_ps(quadrant);
+
+        __m256 x = _mm256_sub_ps(angles, _mm256_mul_ps(whole, _mm256_set1_ps(1.5703125f)));
+        x = _mm256_sub_ps(x, _mm256_mul_ps(whole, _mm256_set1_ps(4.837512969970703125e-4f)));
+        x = _mm256_sub_ps(x, _mm256_mul_ps(whole, _mm256_set1_ps(7.54978995489188216e-8f)));
+
+        __m256 x2 = _mm256_mul_ps(x, x);
+
+        __m256 s = _mm256_add_ps(_mm256_mul_ps(x2, _mm256_set1_ps(-1.9515295891e-4f)), _mm256_set1_ps(8.3321608736e-3f));
+        s = _mm256_add_ps(_mm256_mul_ps(x2, s), _mm256_set1_ps(-1.6666654611e-1f));
+        s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(x2, x), s), x);
+
+        __m256 c = _mm256_add_ps(_mm256_mul_ps(x2, _mm256_set1_ps(2.443315711809948e-5f)), _mm256_set1_ps(-1.388731625493765e-3f));
+        c = _mm256_add_ps(_mm256_mul_ps(x2, c), _mm256_set1_ps(4.166664568298827e-2f));
+        c = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(x2, x2), c), _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(x2, _mm256_set1_ps(0.5f))));
+
+        __m256i one = _mm256_set1_epi32(1);
+        __m256i two = _mm256_set1_epi32(2);
+
+        __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+
+        sine = _mm256_blendv_ps(s, c, swap);
+        cosine = _mm256_blendv_ps(c, s, swap);
+
+        sine = _mm256_xor_ps(sine, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30)));
+        cosine = _mm256_xor_ps(cosine, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30)));
+    }
+
+#endif
+
+#else
+
+    struct Float4
+    {
+        float lanes[4];
+    };
+
+    template <size_t N> requires (N >= 2 && N <= 4)
+    inline Float4 Load(const float* source)
+    {
+        Float4 result{};
+
+        std::memcpy(result.lanes, source, sizeof(float) * N);
+
+        return result;
+    }
+
+    template <size_t N> requires (N >= 2 && N <= 4)
+    inline void Store(float* destination, Float4 value)
+    {
+        std::memcpy(destination, value.lanes, sizeof(float) * N);
+    }
+
+    inline Float4 Splat(float value)
+    {
+        return { value, value, value, value };
+    }
+
+    template <typename Function>
+    inline Float4 PerLane(Float4 a, Float4 b, Function function)
+    {
+        return { function(a.lanes[0], b.lanes[0]), function(a.lanes[1], b.lanes[1]), function(a.lanes[2], b.lanes[2]), function(a.lanes[3], b.lanes[3]) };
+    }
+
+    inline Float4 Add(Float4 a, Float4 b)
+    {
+        return PerLane(a, b, [](float x, float y) { return x + y; });
+    }
+
+    inline Float4 Subtract(Float4 a, Float4 b)
+    {
+        return PerLane(a, b, [](float x, float y) { return x - y; });
+    }
+
+    inline Float4 Multiply(Float4 a, Float4 b)
+    {
+        return PerLane(a, b, [](float x, float y) { return x * y; });
+    }
+
+    inline Float4 Divide(Float4 a, Float4 b)
+    {
+        return PerLane(a, b, [](float x, float y) { return x / y; });
+    }
+
+    inline Float4 MultiplyAdd(Float4 a, Float4 b, Float4 c)
+    {
+        return Add(Multiply(a, b), c);
+    }
+
+    inline Float4 Min(Float4 a, Float4 b)
+    {
+        return PerLane(a, b, [](float x, float y) { return x < y ? x : y; });
+    }
+
+    inline Float4 Max(Float4 a, Float4 b)
+    {
+        return PerLane(a, b, [](float x, float y) { return x > y ? x : y; });
+    }
+
+    inline Float4 Abs(Float4 value)
+    {
+        return PerLane(value, value, [](float x, float) { return std::abs(x); });
+    }
+
+    inline Float4 Sqrt(Float4 value)
+    {
+        return PerLane(value, value, [](float x, float) { return std::sqrt(x); });
+    }
+
+    inline float Dot(Float4 a, Float4 b)
+    {
+        return a.lanes[0] * b.lanes[0] + a.lanes[1] * b.lanes[1] + a.lanes[2] * b.lanes[2] + a.lanes[3] * b.lanes[3];
+    }
+
+    inline Float4 Cross(Float4 a, Float4 b)
+    {
+        return
+        {
+            a.lanes[1] * b.lanes[2] - a.lanes[2] * b.lanes[1],
+            a.lanes[2] * b.lanes[0] - a.lanes[0] * b.lanes[2],
+            a.lanes[0] * b.lanes[1] - a.lanes[1] * b.lanes[0],
+            0.0f
+        };
+    }
+
+    inline bool Equal(Float4 a, Float4 b, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (a.lanes[i] != b.lanes[i])
+                return false;
+        }
+
+        return true;
+    }
+
+    struct Float4x4
+    {
+        Float4 rows[4];
+    };
+
+    inline Float4x4 LoadMatrix(const float* source)
+    {
+        Float4x4 result;
+
+        std::memcpy(result.rows, source, sizeof(float) * 16);
+
+        return result;
+    }
+
+    inline void StoreMatrix(float* destination, const Float4x4& matrix)
+    {
+        std::memcpy(destination, matrix.rows, sizeof(float) * 16);
+    }
+
+    inline Float4 TransformRow(Float4 row, const Float4x4& matrix)
+    {
+        Float4 result{};
+
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+                result.lanes[j] += row.lanes[i] * matrix.rows[i].lanes[j];
+        }
+
+        return result;
+    }
+
+    inline void MultiplyMatrix(const float* a, const float* b, float* result)
+    {
+        Float4x4 left = LoadMatrix(a);
+        Float4x4 right = LoadMatrix(b);
+
+        for (int i = 0; i < 4; ++i)
+            left.rows[i] = TransformRow(left.rows[i], right);
+
+        StoreMatrix(result, left);
+    }
+
+    inline void TransposeMatrix(const float* source, float* result)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+                result[j * 4 + i] = source[i * 4 + j];
+        }
+    }
+
+    inline float InverseMatrix(const float* source, float* result)
+    {
+        const float (&m)[4][4] = *reinterpret_cast<const float (*)[4][4]>(source);
+
+        float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+        float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+        float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+
+        float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+        if (determinant == 0.0f)
+            return determinant;
+
+        float reciprocal = 1.0f / determinant;
+
+        float inverse[16] =
+        {
+             m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3,
+            -m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3,
+             m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3,
+            -m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3,
+
+            -m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1,
+             m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1,
+            -m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1,
+             m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1,
+
+             m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0,
+            -m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0,
+             m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0,
+            -m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0,
+
+            -m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0,
+             m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0,
+            -m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0,
+             m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0
+        };
+
+        for (int i = 0; i < 16; ++i)
+            result[i] = inverse[i] * reciprocal;
+
+        return determinant;
+    }
+
+    inline float AffineInverseMatrix(const float* source, float* result)
+    {
+        Float4x4 m = LoadMatrix(source);
+
+        for (int i = 0; i < 4; ++i)
+            m.rows[i].lanes[3] = 0.0f;
+
+        Float4 column0 = Cross(m.rows[1], m.rows[2]);
+        Float4 column1 = Cross(m.rows[2], m.rows[0]);
+        Float4 column2 = Cross(m.rows[0], m.rows[1]);
+
+        float determinant = Dot(m.rows[0], column0);
+
+        if (determinant == 0.0f)
+            return determinant;
+
+        Float4x4 inverse{};
+
+        for (int i = 0; i < 3; ++i)
+            inverse.rows[i] = { column0.lanes[i] / determinant, column1.lanes[i] / determinant, column2.lanes[i] / determinant, 0.0f };
+
+        Float4 translation = TransformRow(m.rows[3], inverse);
+
+        inverse.rows[3] = { -translation.lanes[0], -translation.lanes[1], -translation.lanes[2], 1.0f };
+
+        StoreMatrix(result, inverse);
+
+        return determinant;
+    }
+
+    inline float InverseTransposeMatrix(const float* source, float* result)
+    {
+        Float4x4 m = LoadMatrix(source);
+
+        for (int i = 0; i < 3; ++i)
+            m.rows[i].lanes[3] = 0.0f;
+
+        Float4 cofactor0 = Cross(m.rows[1], m.rows[2]);
+
+        float determinant = Dot(m.rows[0], cofactor0);
+
+        if (determinant == 0.0f)
+            return determinant;
+
+        Float4 reciprocal = Splat(1.0f / determinant);
+
+        StoreMatrix(result, { Multiply(cofactor0, reciprocal), Multiply(Cross(m.rows[2], m.rows[0]), reciprocal), Multiply(Cross(m.rows[0], m.rows[1]), reciprocal), { 0.0f, 0.0f, 0.0f, 1.0f } });
+
+        return determinant;
+    }
+
+    inline void SinCos4(Float4 angles, Float4& sine, Float4& cosine)
+    {
+        for (int i = 0; i < 4; ++i)
+            Scalar::FastSinCos(angles.lanes[i], sine.lanes[i], cosine.lanes[i]);
+    }
+
+#endif
+
+    inline void SinCos(const float* angles, float* sines, float* cosines, size_t count)
+    {
+        size_t i = 0;
+
+#if INVASION_MATH_AVX2
+        for (; i < count - count % 8; i += 8)
+        {
+            __m256 sine, cosine;
+
+            SinCos8(_mm256_loadu_ps(angles + i), sine, cosine);
+
+            _mm256_storeu_ps(sines + i, sine);
+            _mm256_storeu_ps(cosines + i, cosine);
+        }
+#endif
+
+#if INVASION_MATH_SSE
+        for (; i < count - count % 4; i += 4)
+        {
+            Float4 sine, cosine;
+
+            SinCos4(_mm_loadu_ps(angles + i), sine, cosine);
+
+            _mm_storeu_ps(sines + i, sine);
+            _mm_storeu_ps(cosines + i, cosine);
+        }
+#endif
+
+        for (; i < count; ++i)
+            Scalar::FastSinCos(angles[i], sines[i], cosines[i]);
+    }
+}
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <shared_mutex>
 #include "ECS/Component.hpp"
 #include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+#include "Math/TransformHierarchy.hpp"
 
 using namespace Invasion::ECS;
 
@@ -15,139 +18,138 @@ namespace Invasion::Math
         Transform(const Transform&) = delete;
         Transform& operator=(const Transform&) = delete;
 
-        void Translate(const Vector<float, 3>& translation)
+        ~Transform() override
         {
-            std::unique_lock lock(mutex_);
+            for (const auto& child : children.Read())
+            {
+                std::unique_lock childLock(child->mutex_);
 
-            localPosition += translation;
+                child->parent.reset();
 
-            MarkDirty();
+                TransformHierarchy::GetInstance().SetParent(child->handle_, TransformHierarchy::Invalid);
+            }
+
+            TransformHierarchy::GetInstance().Release(handle_);
         }
 
-        void Rotate(const Vector<float, 3>& rotation)
+        void Translate(const Vector<float, 3>& translation)
         {
-            std::unique_lock lock(mutex_);
-
-            localRotation += rotation;
+            TransformHierarchy::GetInstance().Translate(handle_, translation);
+        }
 
-            MarkDirty();
+        void Rotate(const Vector<float, 3>& rotation)
+        {
+            TransformHierarchy::GetInstance().Rotate(handle_, rotation);
         }
 
         void Scale(const Vector<float, 3>& scale)
         {
-            std::unique_lock lock(mutex_);
-
-            localScale *= scale;
-
-            MarkDirty();
+            TransformHierarchy::GetInstance().Scale(handle_, scale);
         }
 
         Vector<float, 3> GetLocalPosition() const
         {
-            std::shared_lock lock(mutex_);
-
-            return localPosition;
+            return TransformHierarchy::GetInstance().GetLocalPosition(handle_);
         }
 
         Vector<float, 3> GetLocalRotation() const
         {
-            std::shared_lock lock(mutex_);
+            return TransformHierarchy::GetInstance().GetLocalRotation(handle_);
+        }
 
-            return localRotation;
+        Quaternion<float> GetLocalOrientation() const
+        {
+            return TransformHierarchy::GetInstance().GetLocalOrientation(handle_);
         }
 
         Vector<float, 3> GetLocalScale() const
         {
-            std::shared_lock lock(mutex_);
-
-            return localScale;
+            return TransformHierarchy::GetInstance().GetLocalScale(handle_);
         }
 
         void SetLocalPosition(const Vector<float, 3>& position)
         {
-            std::unique_lock lock(mutex_);
-            localPosition = position;
-
-            MarkDirty();
+            TransformHierarchy::GetInstance().SetLocalPosition(handle_, position);
         }
 
         void SetLocalRotation(const Vector<float, 3>& rotation)
         {
-            std::unique_lock lock(mutex_);
-            localRotation = rotation;
+            TransformHierarchy::GetInstance().SetLocalRotation(handle_, rotation);
+        }
 
-            MarkDirty();
+        void SetLocalOrientation(const Quaternion<float>& orientation)
+        {
+            TransformHierarchy::GetInstance().SetLocalOrientation(handle_, orientation);
         }
 
         void SetLocalScale(const Vector<float, 3>& scale)
         {
-            std::unique_lock lock(mutex_);
-            localScale = scale;
-
-            MarkDirty();
+            TransformHierarchy::GetInstance().SetLocalScale(handle_, scale);
         }
 
         Vector<float, 3> GetWorldPosition()
         {
-            UpdateWorldTransform();
-
-            std::shared_lock lock(mutex_);
-
-            return worldPosition;
+            return TransformHierarchy::GetInstance().GetWorldPosition(handle_);
         }
 
         Vector<float, 3> GetWorldRotation()
         {
-            UpdateWorldTransform();
-
-            std::shared_lock lock(mutex_);
+            return GetWorldOrientation().ToEuler();
+        }
 
-            return worldRotation;
+        Quaternion<float> GetWorldOrientation()
+        {
+            return TransformHierarchy::GetInstance().GetWorldOrientation(handle_);
         }
 
         Vector<float, 3> GetWorldScale()
         {
-            UpdateWorldTransform();
-
-            std::shared_lock lock(mutex_);
-
-            return worldScale;
+            return TransformHierarchy::GetInstance().GetWorldScale(handle_);
         }
 
         Vector<float, 3> GetRight()
         {
-            UpdateWorldTransform();
-
-            std::shared_lock lock(mutex_);
-                
-            return Vector<float, 3>{ worldMatrix[0][0], worldMatrix[0][1], worldMatrix[0][2] }.Normalize();
+            return GetWorldOrientation().Rotate({ 1.0f, 0.0f, 0.0f });
         }
 
         Vector<float, 3> GetUp()
         {
-            UpdateWorldTransform();
-
-            std::shared_lock lock(mutex_);
-                
-            return Vector<float, 3>{ worldMatrix[1][0], worldMatrix[1][1], worldMatrix[1][2] }.Normalize();
+            return GetWorldOrientation().Rotate({ 0.0f, 1.0f, 0.0f });
         }
 
         Vector<float, 3> GetForward()
         {
-            UpdateWorldTransform();
-
-            std::shared_lock lock(mutex_);
-                
-            return Vector<float, 3>{ worldMatrix[2][0], worldMatrix[2][1], worldMatrix[2][2] }.Normalize();
+            return GetWorldOrientation().Rotate({ 0.0f, 0.0f, 1.0f });
         }
 
         Matrix<float, 4, 4> GetModelMatrix()
         {
-            UpdateWorldTransform();
+            return TransformHierarchy::GetInstance().GetWorldMatrix(handle_);
+        }
 
-            std::shared_lock lock(mutex_);
+        Matrix<float, 4, 4> GetNormalMatrix()
+        {
+            return TransformHierarchy::GetInstance().GetNormalMatrix(handle_);
+        }
 
-            return worldMatrix;
+        uint32_t GetWorldVersion()
+        {
+            return TransformHierarchy::GetInstance().GetWorldVersion(handle_);
+        }
+
+        uint32_t AddObserver(TransformHierarchy::Observer observer)
+        {
+            return TransformHierarchy::GetInstance().AddObserver(handle_, std::move(observer));
+        }
+
+        void RemoveObserver(uint32_t id)
+        {
+            TransformHierarchy::GetInstance().RemoveObserver(id);
+        }
+
+        uint32_t GetHandle() const
+        {
+            return handle_;
         }
 
         void SetParent(const Shared<Transform>& parent)
@@ -156,15 +158,15 @@ namespace Invasion::Math
 
             if (this->parent.lock() != parent)
             {
+                TransformHierarchy::GetInstance().SetParent(handle_, parent ? parent->handle_ : TransformHierarchy::Invalid);
+
                 if (auto currentParent = this->parent.lock())
                     currentParent->RemoveChild(shared_from_this());
-                    
+
                 this->parent = parent;
 
                 if (parent)
                     parent->AddChild(shared_from_this());
-                    
-                MarkDirty();
             }
         }
 
@@ -174,7 +176,7 @@ namespace Invasion::Math
             return parent.lock();
         }
 
-        const MutableArray<Shared<Transform>> GetChildren() const
+        const SmallArray<Shared<Transform>, 4> GetChildren() const
         {
             std::shared_lock lock(mutex_);
             return children;
@@ -202,100 +204,18 @@ namespace Invasion::Math
 
     private:
 
-        Transform() : localPosition{ 0.0f, 0.0f, 0.0f }, localRotation{ 0.0f, 0.0f, 0.0f }, localScale{ 1.0f, 1.0f, 1.0f }, isDirty_{ true } { }
-
-        void MarkDirty()
-        {
-            isDirty_ = true;
-
-            for (const auto& child : children)
-                child->MarkDirty();
-        }
-
-        void UpdateWorldTransform()
-        {
-            std::unique_lock lock(mutex_);
-
-            if (isDirty_)
-            {
-                Matrix<float, 4, 4> translationMatrix = Matrix<float, 4, 4>::Translation(localPosition);
-                Matrix<float, 4, 4> rotationMatrix = Matrix<float, 4, 4>::EulerRotation(localRotation);
-                Matrix<float, 4, 4> scaleMatrix = Matrix<float, 4, 4>::Scale(localScale);
-
-                Matrix<float, 4, 4> localMatrix = scaleMatrix * rotationMatrix * translationMatrix;
-
-                if (auto parent = this->parent.lock())
-                {
-                    lock.unlock();
-
-                    parent->UpdateWorldTransform();
-
-                    lock.lock();
-
-                    std::shared_lock parentLock(parent->mutex_);
-                        
-                    worldMatrix = localMatrix * parent->worldMatrix;
-                }
-                else
-                    worldMatrix = localMatrix;
-
-                DecomposeMatrix(worldMatrix, worldPosition, worldRotation, worldScale);
-
-                isDirty_ = false;
-            }
-        }
-
-        void DecomposeMatrix(const Matrix<float, 4, 4>& matrix, Vector<float, 3>& position, Vector<float, 3>& rotation, Vector<float, 3>& scale)
-        {
-            position = Vector<float, 3>{ matrix[3][0], matrix[3][1], matrix[3][2] };
-
-            scale = Vector<float, 3>
-            {
-                std::sqrt(matrix[0][0] * matrix[0][0] + matrix[0][1] * matrix[0][1] + matrix[0][2] * matrix[0][2]),
-                std::sqrt(matrix[1][0] * matrix[1][0] + matrix[1][1] * matrix[1][1] + matrix[1][2] * matrix[1][2]),
-                std::sqrt(matrix[2][0] * matrix[2][0] + matrix[2][1] * matrix[2][1] + matrix[2][2] * matrix[2][2])
-            };
-
-            Matrix<float, 4, 4> rotationMatrix = matrix;
-
-            for (int i = 0; i < 3; ++i)
-            {
-                rotationMatrix[0][i] /= scale[0];
-                rotationMatrix[1][i] /= scale[1];
-                rotationMatrix[2][i] /= scale[2];
-            }
-
-            rotation[1] = std::asin(-matrix[2][0]);
-
-            if (std::cos(rotation[1]) != 0)
-            {
-                rotation[0] = std::atan2(matrix[2][1], matrix[2][2]);
-                rotation[2] = std::atan2(matrix[1][0], matrix[0][0]);
-            }
-            else
-            {
-                rotation[0] = std::atan2(-matrix[0][2], matrix[1][1]);
-                rotation[2] = 0;
-            }
-
-            rotation = rotation * (180.0f / static_cast<float>(DirectX::XM_PI));
-        }
+        Transform() : handle_(TransformHierarchy::GetInstance().Allocate()) { }
 
+#ifdef INVASION_TRANSFORM_PHASE_CHECKED
+        static inline TransformHierarchy::Mutex mutex_;
+#else
         mutable std::shared_mutex mutex_;
+#endif
 
-        Vector<float, 3> localPosition;
-        Vector<float, 3> localRotation;
-        Vector<float, 3> localScale;
-
-        Vector<float, 3> worldPosition;
-        Vector<float, 3> worldRotation;
-        Vector<float, 3> worldScale;
-        Matrix<float, 4, 4> worldMatrix;
+        uint32_t handle_;
 
         Weak<Transform> parent;
 
-        MutableArray<Shared<Transform>> children;
-
-        bool isDirty_;
+        SmallArray<Shared<Transform>, 4> children;
     };
 }
\ No newline at end of file
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include "Math/Matrix.hpp"
+#include "Math/Simd.hpp"
+#include "Util/Threading/ThreadPool.hpp"
+
+namespace Invasion::Math
+{
+    class TransformBatch
+    {
+
+    public:
+
+        static constexpr size_t ParallelChunkSize = 4096;
+
+        TransformBatch() = delete;
+
+        static void TransformPoints(const Matrix<float, 4, 4>& matrix, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+        {
+            TransformStreams(MakeKernel(matrix, true, false), x, y, z, outX, outY, outZ, 0, count);
+        }
+
+        static void TransformDirections(const Matrix<float, 4, 4>& matrix, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+        {
+            TransformStreams(MakeKernel(matrix, false, false), x, y, z, outX, outY, outZ, 0, count);
+        }
+
+        static void TransformNormals(const Matrix<float, 4, 4>& matrix, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+        {
+            TransformStreams(MakeKernel(matrix.NormalMatrix(), false, true), x, y, z, outX, outY, outZ, 0, count);
+        }
+
+        static void TransformPoints(const Matrix<float, 4, 4>& matrix, const void* source, size_t sourceStride, void* destination, size_t destinationStride, size_t count)
+        {
+            TransformStrided(MakeKernel(matrix, true, false), source, sourceStride, destination, destinationStride, 0, count);
+        }
+
+        static void TransformDirections(const Matrix<float, 4, 4>& matrix, const void* source, size_t sourceStride, void* destination, size_t destinationStride, size_t count)
+        {
+            TransformStrided(MakeKernel(matrix, false, false), source, sourceStride, destination, destinationStride, 0, count);
+        }
+
+        static void TransformNormals(const Matrix<float, 4, 4>& matrix, const void* source, size_t sourceStride, void* destination, size_t destinationStride, size_t count)
+        {
+            TransformStrided(MakeKernel(matrix.NormalMatrix(), false, true), source, sourceStride, destination, destinationStride, 0, count);
+        }
+
+        static void TransformPoints(Util::Threading::ThreadPool& pool, const Matrix<float, 4, 4>& matrix, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+        {
+            Kernel kernel = MakeKernel(matrix, true, false);
+
+            pool.ParallelFor(count, ParallelChunkSize, [&](size_t begin, size_t end) { TransformStreams(kernel, x, y, z, outX, outY, outZ, begin, end); });
+        }
+
+        static void TransformDirections(Util::Threading::ThreadPool& pool, const Matrix<float, 4, 4>& matrix, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+        {
+            Kernel kernel = MakeKernel(matrix, false, false);
+
+            pool.ParallelFor(count, ParallelChunkSize, [&](size_t begin, size_t end) { TransformStreams(kernel, x, y, z, outX, outY, outZ, begin, end); });
+        }
+
+        static void TransformNormals(Util::Threading::ThreadPool& pool, const Matrix<float, 4, 4>& matrix, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+        {
+            Kernel kernel = MakeKernel(matrix.NormalMatrix(), false, true);
+
+            pool.ParallelFor(count, ParallelChunkSize, [&](size_t begin, size_t end) { TransformStreams(kernel, x, y, z, outX, outY, outZ, begin, end); });
+        }
+
+        static void TransformPoints(Util::Threading::ThreadPool& pool, const Matrix<float, 4, 4>& matrix, const void* source, size_t sourceStride, void* destination, size_t destinationStride, size_t count)
+        {
+            Kernel kernel = MakeKernel(matrix, true, false);
+
+            pool.ParallelFor(count, ParallelChunkSize, [&](size_t begin, size_t end) { TransformStrided(kernel, source, sourceStride, destination, destinationStride, begin, end); });
+        }
+
+        static void TransformDirections(Util::Threading::ThreadPool& pool, const Matrix<float, 4, 4>& matrix, const void* source, size_t sourceStride, void* destination, size_t destinationStride, size_t count)
+        {
+            Kernel kernel = MakeKernel(matrix, false, false);
+
+            pool.ParallelFor(count, ParallelChunkSize, [&](size_t begin, size_t end) { TransformStrided(kernel, source, sourceStride, destination, destinationStride, begin, end); });
+        }
+
+        static void TransformNormals(Util::Threading::ThreadPool& pool, const Matrix<float, 4, 4>& matrix, const void* source, size_t sourceStride, void* destination, size_t destinationStride, size_t count)
+        {
+            Kernel kernel = MakeKernel(matrix.NormalMatrix(), false, true);
+
+            pool.ParallelFor(count, ParallelChunkSize, [&](size_t begin, size_t end) { TransformStrided(kernel, source, sourceStride, destination, destinationStride, begin, end); });
+        }
+
+    private:
+
+        struct Kernel
+        {
+            alignas(16) float rows[4][4];
+            bool normalize;
+        };
+
+        static Kernel MakeKernel(const Matrix<float, 4, 4>& matrix, bool translate, bool normalize)
+        {
+            Kernel kernel{};
+
+            for (size_t i = 0; i < (translate ? 4 : 3); ++i)
+            {
+                for (size_t j = 0; j < 3; ++j)
+                    kernel.rows[i][j] = matrix[i][j];
+            }
+
+            kernel.normalize = normalize;
+
+            return kernel;
+        }
+
+        static void TransformStreams(const Kernel& kernel, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t begin, size_t end)
+        {
+            const Kernel local = kernel;
+
+            size_t i = begin;
+
+#if INVASION_MATH_AVX2
+            __m256 rows[4][3];
+
+            for (size_t r = 0; r < 4; ++r)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                    rows[r][c] = _mm256_set1_ps(local.rows[r][c]);
+            }
+
+            for (; i < end - (end - begin) % 8; i += 8)
+            {
+                __m256 px = _mm256_loadu_ps(x + i);
+                __m256 py = _mm256_loadu_ps(y + i);
+                __m256 pz = _mm256_loadu_ps(z + i);
+
+                __m256 result[3];
+
+                for (size_t c = 0; c < 3; ++c)
+                    result[c] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, rows[0][c]), _mm256_mul_ps(py, rows[1][c])), _mm256_add_ps(_mm256_mul_ps(pz, rows[2][c]), rows[3][c]));
+
+                if (local.normalize)
+                {
+                    __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(result[0], result[0]), _mm256_mul_ps(result[1], result[1])), _mm256_mul_ps(result[2], result[2])));
+
+                    for (size_t c = 0; c < 3; ++c)
+                        result[c] = _mm256_div_ps(result[c], length);
+                }
+
+                _mm256_storeu_ps(outX + i, result[0]);
+                _mm256_storeu_ps(outY + i, result[1]);
+                _mm256_storeu_ps(outZ + i, result[2]);
+            }
+#endif
+
+#if INVASION_MATH_SSE
+            __m128 lanes[4][3];
+
+            for (size_t r = 0; r < 4; ++r)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                    lanes[r][c] = _mm_set1_ps(local.rows[r][c]);
+            }
+
+            for (; i < end - (end - begin) % 4; i += 4)
+            {
+                __m128 px = _mm_loadu_ps(x + i);
+                __m128 py = _mm_loadu_ps(y + i);
+                __m128 pz = _mm_loadu_ps(z + i);
+
+                __m128 result[3];
+
+                for (size_t c = 0; c < 3; ++c)
+                    result[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, lanes[0][c]), _mm_mul_ps(py, lanes[1][c])), _mm_add_ps(_mm_mul_ps(pz, lanes[2][c]), lanes[3][c]));
+
+                if (local.normalize)
+                {
+                    __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(result[0], result[0]), _mm_mul_ps(result[1], result[1])), _mm_mul_ps(result[2], result[2])));
+
+                    for (size_t c = 0; c < 3; ++c)
+                        result[c] = _mm_div_ps(result[c], length);
+                }
+
+                _mm_storeu_ps(outX + i, result[0]);
+                _mm_storeu_ps(outY + i, result[1]);
+                _mm_storeu_ps(outZ + i, result[2]);
+            }
+#endif
+
+            for (; i < end; ++i)
+            {
+                float px = x[i];
+                float py = y[i];
+                float pz = z[i];
+
+                float result[3];
+
+                for (size_t c = 0; c < 3; ++c)
+                    result[c] = px * local.rows[0][c] + py * local.rows[1][c] + (pz * local.rows[2][c] + local.rows[3][c]);
+
+                if (local.normalize)
+                {
+                    float length = std::sqrt(result[0] * result[0] + result[1] * result[1] + result[2] * result[2]);
+
+                    for (size_t c = 0; c < 3; ++c)
+                        result[c] /= length;
+                }
+
+                outX[i] = result[0];
+                outY[i] = result[1];
+                outZ[i] = result[2];
+            }
+        }
+
+        static void TransformStrided(const Kernel& kernel, const void* source, size_t sourceStride, void* destination, size_t destinationStride, size_t begin, size_t end)
+        {
+            Simd::Float4x4 matrix = Simd::LoadMatrix(&kernel.rows[0][0]);
+
+            const std::byte* input = static_cast<const std::byte*>(source) + begin * sourceStride;
+            std::byte* output = static_cast<std::byte*>(destination) + begin * destinationStride;
+
+            for (size_t i = begin; i < end; ++i, input += sourceStride, output += destinationStride)
+            {
+                alignas(16) float lanes[4] = {};
+
+                std::memcpy(lanes, input, sizeof(float) * 3);
+
+                Simd::Float4 result = Simd::Add(Simd::TransformRow(Simd::Load<4>(lanes), matrix), matrix.rows[3]);
+
+                if (kernel.normalize)
+                    result = Simd::Divide(result, Simd::Splat(std::sqrt(Simd::Dot(result, result))));
+
+                Simd::Store<4>(lanes, result);
+
+                std::memcpy(output, lanes, sizeof(float) * 3);
+            }
+        }
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,657 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <vector>
+#include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+#include "Util/Threading/ThreadPool.hpp"
+#include "Util/Types/LockPolicy.hpp"
+
+namespace Invasion::Math
+{
+    enum class FramePhase
+    {
+        Update,
+        Render
+    };
+
+    class TransformHierarchy
+    {
+
+    public:
+
+        static constexpr uint32_t Invalid = UINT32_MAX;
+        static constexpr size_t ParallelGrainSize = 256;
+
+        using Observer = std::function<void()>;
+
+#ifdef INVASION_TRANSFORM_PHASE_CHECKED
+        using Mutex = Util::Types::NullMutex;
+#else
+        using Mutex = std::shared_mutex;
+#endif
+
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+        uint32_t Allocate()
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t handle;
+
+            if (!freeHandles_.empty())
+            {
+                handle = freeHandles_.back();
+                freeHandles_.pop_back();
+            }
+            else
+            {
+                handle = static_cast<uint32_t>(indices_.size());
+                indices_.push_back(Invalid);
+            }
+
+            indices_[handle] = static_cast<uint32_t>(handles_.size());
+
+            PushNode(handle, 0);
+
+            isDirty_ = true;
+            isOrderDirty_ = true;
+
+            return handle;
+        }
+
+        void Release(uint32_t handle)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            handles_[indices_[handle]] = Invalid;
+            indices_[handle] = Invalid;
+
+            freeHandles_.push_back(handle);
+
+            std::erase_if(observers_, [handle](const ObserverEntry& entry) { return entry.handle == handle; });
+
+            isOrderDirty_ = true;
+        }
+
+        void SetParent(uint32_t handle, uint32_t parent)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+            uint32_t parentIndex = parent == Invalid ? 0 : indices_[parent];
+
+            for (uint32_t ancestor = parentIndex; ancestor != 0; ancestor = parents_[ancestor])
+            {
+                if (ancestor == index)
+                    throw std::invalid_argument("Transform cannot be parented to itself or its descendant");
+            }
+
+            if (parents_[index] == parentIndex)
+                return;
+
+            parents_[index] = parentIndex;
+            ++localVersion_[index];
+            isDirty_ = true;
+
+            isOrderDirty_ = true;
+        }
+
+        Vector<float, 3> GetLocalPosition(uint32_t handle) const
+        {
+            std::shared_lock lock(mutex_);
+
+            return localPosition_[indices_[handle]];
+        }
+
+        Vector<float, 3> GetLocalRotation(uint32_t handle) const
+        {
+            std::shared_lock lock(mutex_);
+
+            return localRotation_[indices_[handle]];
+        }
+
+        Quaternion<float> GetLocalOrientation(uint32_t handle) const
+        {
+            std::shared_lock lock(mutex_);
+
+            return localOrientation_[indices_[handle]];
+        }
+
+        Vector<float, 3> GetLocalScale(uint32_t handle) const
+        {
+            std::shared_lock lock(mutex_);
+
+            return localScale_[indices_[handle]];
+        }
+
+        void SetLocalPosition(uint32_t handle, const Vector<float, 3>& position)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+
+            localPosition_[index] = position;
+            ++localVersion_[index];
+            isDirty_ = true;
+        }
+
+        void SetLocalRotation(uint32_t handle, const Vector<float, 3>& rotation)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+
+            localRotation_[index] = rotation;
+            localOrientation_[index] = Quaternion<float>::FromEuler(rotation);
+            ++localVersion_[index];
+            isDirty_ = true;
+        }
+
+        void SetLocalOrientation(uint32_t handle, const Quaternion<float>& orientation)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+
+            localOrientation_[index] = orientation.Normalize();
+            localRotation_[index] = localOrientation_[index].ToEuler();
+            ++localVersion_[index];
+            isDirty_ = true;
+        }
+
+        void SetLocalScale(uint32_t handle, const Vector<float, 3>& scale)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+
+            localScale_[index] = scale;
+            ++localVersion_[index];
+            isDirty_ = true;
+        }
+
+        void Translate(uint32_t handle, const Vector<float, 3>& translation)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+
+            localPosition_[index] += translation;
+            ++localVersion_[index];
+            isDirty_ = true;
+        }
+
+        void Rotate(uint32_t handle, const Vector<float, 3>& rotation)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+
+            localRotation_[index] += rotation;
+            localOrientation_[index] = Quaternion<float>::FromEuler(localRotation_[index]);
+            ++localVersion_[index];
+            isDirty_ = true;
+        }
+
+        void Scale(uint32_t handle, const Vector<float, 3>& scale)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = indices_[handle];
+
+            localScale_[index] *= scale;
+            ++localVersion_[index];
+            isDirty_ = true;
+        }
+
+        Vector<float, 3> GetWorldPosition(uint32_t handle)
+        {
+            return Read(handle, worldPosition_);
+        }
+
+        // World orientation and scale compose the local TRS components directly, so they only match
+        // the world matrix when every ancestor is uniformly scaled; use GetWorldMatrix for exact results.
+        Quaternion<float> GetWorldOrientation(uint32_t handle)
+        {
+            return Read(handle, worldOrientation_);
+        }
+
+        Vector<float, 3> GetWorldScale(uint32_t handle)
+        {
+            return Read(handle, worldScale_);
+        }
+
+        Matrix<float, 4, 4> GetWorldMatrix(uint32_t handle)
+        {
+            return Read(handle, worldMatrix_);
+        }
+
+        Matrix<float, 4, 4> GetNormalMatrix(uint32_t handle)
+        {
+            {
+                std::shared_lock lock(mutex_);
+
+                uint32_t index = indices_[handle];
+
+                if (!isDirty_ && normalVersion_[index] == worldVersion_[index])
+                    return normalMatrix_[index];
+            }
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t index = Resolve(handle);
+
+            if (normalVersion_[index] != worldVersion_[index])
+            {
+                normalMatrix_[index] = worldMatrix_[index].NormalMatrix();
+                normalVersion_[index] = worldVersion_[index];
+            }
+
+            return normalMatrix_[index];
+        }
+
+        uint32_t GetWorldVersion(uint32_t handle)
+        {
+            return Read(handle, worldVersion_);
+        }
+
+        uint32_t AddObserver(uint32_t handle, Observer observer)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            uint32_t id = nextObserverId_++;
+
+            observers_.push_back({ id, handle, worldVersion_[Resolve(handle)], std::move(observer) });
+
+            return id;
+        }
+
+        void RemoveObserver(uint32_t id)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            std::erase_if(observers_, [id](const ObserverEntry& entry) { return entry.id == id; });
+        }
+
+        void Update()
+        {
+            Update(Util::Threading::ThreadPool::GetInstance());
+        }
+
+        void Update(Util::Threading::ThreadPool& pool)
+        {
+            AssertWritable();
+
+            std::unique_lock lock(mutex_);
+
+            if (isOrderDirty_)
+                Sort();
+
+            if (!isDirty_)
+                return;
+
+            for (size_t level = 0; level + 1 < levels_.size(); ++level)
+            {
+                const size_t offset = levels_[level];
+
+                pool.ParallelFor(levels_[level + 1] - offset, ParallelGrainSize, [this, offset](size_t begin, size_t end)
+                {
+                    for (size_t i = offset + begin; i < offset + end; ++i)
+                    {
+                        if (IsStale(i))
+                            Compute(i);
+                    }
+                });
+            }
+
+            isDirty_ = false;
+
+            std::vector<Observer> pending;
+
+            for (ObserverEntry& entry : observers_)
+            {
+                uint32_t version = worldVersion_[indices_[entry.handle]];
+
+                if (entry.version != version)
+                {
+                    entry.version = version;
+                    pending.push_back(entry.observer);
+                }
+            }
+
+            lock.unlock();
+
+            for (const Observer& observer : pending)
+                observer();
+        }
+
+        void SetPhase(FramePhase phase)
+        {
+            phase_.store(phase, std::memory_order_release);
+        }
+
+        FramePhase GetPhase() const
+        {
+            return phase_.load(std::memory_order_acquire);
+        }
+
+        size_t GetCount() const
+        {
+            std::shared_lock lock(mutex_);
+
+            return indices_.size() - freeHandles_.size() - 1;
+        }
+
+        static TransformHierarchy& GetInstance()
+        {
+            std::call_once(initFlag, []()
+            {
+                instance.reset(new TransformHierarchy);
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct ObserverEntry
+        {
+            uint32_t id;
+            uint32_t handle;
+            uint32_t version;
+
+            Observer observer;
+        };
+
+        TransformHierarchy()
+        {
+            indices_.push_back(0);
+
+            PushNode(0, 0);
+
+            normalMatrix_[0] = Matrix<float, 4, 4>::Identity();
+        }
+
+        void PushNode(uint32_t handle, uint32_t parent)
+        {
+            localPosition_.push_back({ 0.0f, 0.0f, 0.0f });
+            localRotation_.push_back({ 0.0f, 0.0f, 0.0f });
+            localOrientation_.push_back(Quaternion<float>::Identity());
+            localScale_.push_back({ 1.0f, 1.0f, 1.0f });
+
+            worldPosition_.push_back({ 0.0f, 0.0f, 0.0f });
+            worldOrientation_.push_back(Quaternion<float>::Identity());
+            worldScale_.push_back({ 1.0f, 1.0f, 1.0f });
+            worldMatrix_.push_back(Matrix<float, 4, 4>::Identity());
+            normalMatrix_.push_back({});
+
+            parents_.push_back(parent);
+            handles_.push_back(handle);
+            localVersion_.push_back(1);
+            computedVersion_.push_back(0);
+            parentVersion_.push_back(0);
+            worldVersion_.push_back(0);
+            normalVersion_.push_back(0);
+        }
+
+        void AssertWritable() const
+        {
+#ifdef INVASION_TRANSFORM_PHASE_CHECKED
+            assert(GetPhase() == FramePhase::Update && "Transforms can only be written during the update phase.");
+#endif
+        }
+
+        template <typename T>
+        T Read(uint32_t handle, const std::vector<T>& values)
+        {
+            {
+                std::shared_lock lock(mutex_);
+
+                if (!isDirty_)
+                    return values[indices_[handle]];
+            }
+
+            std::unique_lock lock(mutex_);
+
+            return values[Resolve(handle)];
+        }
+
+        uint32_t Resolve(uint32_t handle)
+        {
+            uint32_t index = indices_[handle];
+
+            if (!isDirty_)
+                return index;
+
+            AssertWritable();
+
+            chain_.clear();
+
+            for (uint32_t node = index; node != 0; node = parents_[node])
+                chain_.push_back(node);
+
+            for (size_t i = chain_.size(); i > 0; --i)
+            {
+                if (IsStale(chain_[i - 1]))
+                    Compute(chain_[i - 1]);
+            }
+
+            return index;
+        }
+
+        bool IsStale(size_t index) const
+        {
+            return computedVersion_[index] != localVersion_[index] || parentVersion_[index] != worldVersion_[parents_[index]];
+        }
+
+        void Compute(size_t index)
+        {
+            const uint32_t parent = parents_[index];
+
+            const Vector<float, 3>& position = localPosition_[index];
+            const Quaternion<float>& orientation = localOrientation_[index];
+            const Vector<float, 3>& scale = localScale_[index];
+
+            worldMatrix_[index] = ComposeMatrix(position, orientation, scale) * worldMatrix_[parent];
+
+            const Matrix<float, 4, 4>& world = worldMatrix_[index];
+
+            worldPosition_[index] = { world[3][0], world[3][1], world[3][2] };
+            worldOrientation_[index] = worldOrientation_[parent] * orientation;
+            worldScale_[index] = worldScale_[parent] * scale;
+
+            computedVersion_[index] = localVersion_[index];
+            parentVersion_[index] = worldVersion_[parent];
+
+            ++worldVersion_[index];
+
+#ifdef INVASION_TRANSFORM_PHASE_CHECKED
+            normalMatrix_[index] = worldMatrix_[index].NormalMatrix();
+            normalVersion_[index] = worldVersion_[index];
+#endif
+        }
+
+        void Sort()
+        {
+            const size_t count = parents_.size();
+
+            std::vector<uint32_t> offsets(count + 1, 0);
+
+            for (size_t i = 1; i < count; ++i)
+            {
+                if (handles_[i] == Invalid)
+                    continue;
+
+                if (handles_[parents_[i]] == Invalid)
+                {
+                    parents_[i] = 0;
+                    ++localVersion_[i];
+                    isDirty_ = true;
+                }
+
+                ++offsets[parents_[i] + 1];
+            }
+
+            for (size_t i = 1; i <= count; ++i)
+                offsets[i] += offsets[i - 1];
+
+            std::vector<uint32_t> children(offsets[count]);
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+
+            for (size_t i = 1; i < count; ++i)
+            {
+                if (handles_[i] != Invalid)
+                    children[cursor[parents_[i]]++] = static_cast<uint32_t>(i);
+            }
+
+            std::vector<uint32_t> order;
+
+            order.reserve(children.size() + 1);
+            order.push_back(0);
+
+            levels_.assign(1, 1);
+
+            for (size_t begin = 0, end = 1; begin < end; begin = end, end = order.size())
+            {
+                for (size_t i = begin; i < end; ++i)
+                    order.insert(order.end(), children.begin() + offsets[order[i]], children.begin() + offsets[order[i] + 1]);
+
+                if (order.size() > end)
+                    levels_.push_back(static_cast<uint32_t>(order.size()));
+            }
+
+            std::vector<uint32_t> remap(count, Invalid);
+
+            for (size_t i = 0; i < order.size(); ++i)
+                remap[order[i]] = static_cast<uint32_t>(i);
+
+            Permute(localPosition_, order);
+            Permute(localRotation_, order);
+            Permute(localOrientation_, order);
+            Permute(localScale_, order);
+            Permute(worldPosition_, order);
+            Permute(worldOrientation_, order);
+            Permute(worldScale_, order);
+            Permute(worldMatrix_, order);
+            Permute(normalMatrix_, order);
+            Permute(parents_, order);
+            Permute(handles_, order);
+            Permute(localVersion_, order);
+            Permute(computedVersion_, order);
+            Permute(parentVersion_, order);
+            Permute(worldVersion_, order);
+            Permute(normalVersion_, order);
+
+            for (size_t i = 1; i < order.size(); ++i)
+            {
+                parents_[i] = remap[parents_[i]];
+                indices_[handles_[i]] = static_cast<uint32_t>(i);
+            }
+
+            isOrderDirty_ = false;
+        }
+
+        template <typename T>
+        static void Permute(std::vector<T>& values, const std::vector<uint32_t>& order)
+        {
+            std::vector<T> result;
+
+            result.reserve(order.size());
+
+            for (uint32_t index : order)
+                result.push_back(values[index]);
+
+            values.swap(result);
+        }
+
+        static Matrix<float, 4, 4> ComposeMatrix(const Vector<float, 3>& position, const Quaternion<float>& orientation, const Vector<float, 3>& scale)
+        {
+            Matrix<float, 4, 4> result = orientation.ToMatrix();
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                for (size_t j = 0; j < 3; ++j)
+                    result[i][j] *= scale[i];
+
+                result[3][i] = position[i];
+            }
+
+            return result;
+        }
+
+        mutable Mutex mutex_;
+
+        std::vector<Vector<float, 3>> localPosition_;
+        std::vector<Vector<float, 3>> localRotation_;
+        std::vector<Quaternion<float>> localOrientation_;
+        std::vector<Vector<float, 3>> localScale_;
+
+        std::vector<Vector<float, 3>> worldPosition_;
+        std::vector<Quaternion<float>> worldOrientation_;
+        std::vector<Vector<float, 3>> worldScale_;
+        std::vector<Matrix<float, 4, 4>> worldMatrix_;
+        std::vector<Matrix<float, 4, 4>> normalMatrix_;
+
+        std::vector<uint32_t> parents_;
+        std::vector<uint32_t> handles_;
+        std::vector<uint32_t> localVersion_;
+        std::vector<uint32_t> computedVersion_;
+        std::vector<uint32_t> parentVersion_;
+        std::vector<uint32_t> worldVersion_;
+        std::vector<uint32_t> normalVersion_;
+
+        std::vector<uint32_t> indices_;
+        std::vector<uint32_t> freeHandles_;
+        std::vector<uint32_t> levels_;
+        std::vector<uint32_t> chain_;
+
+        std::vector<ObserverEntry> observers_;
+
+        uint32_t nextObserverId_ = 0;
+
+        std::atomic<FramePhase> phase_ = FramePhase::Update;
+
+        bool isDirty_ = false;
+        bool isOrderDirty_ = false;
+
+        static std::unique_ptr<TransformHierarchy> instance;
+        static std::once_flag initFlag;
+    };
+
+    std::unique_ptr<TransformHierarchy> TransformHierarchy::instance;
+    std::once_flag TransformHierarchy::initFlag;
+}
\ No newline at end of file
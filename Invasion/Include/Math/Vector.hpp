@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cmath>
@@ -8,139 +9,127 @@
 #include <functional>
 #include <initializer_list>
 #include <iostream>
-#include <memory>
-#include <shared_mutex>
-#include <ranges>
 #include <stdexcept>
 #include <type_traits>
+#include "Math/Scalar.hpp"
+#include "Math/Simd.hpp"
+
+#if __has_include(<DirectXMath.h>)
+#include <DirectXMath.h>
+#endif
 
 namespace Invasion::Math
 {
     template <typename T>
-    concept Arithmetic = std::is_arithmetic_v<T>;
+    struct ArithmeticTraits
+    {
+        static constexpr bool IsArithmetic = std::is_arithmetic_v<T>;
+    };
 
-    template <Arithmetic T, size_t N>
-    class Vector;
+    template <typename T>
+    concept Arithmetic = ArithmeticTraits<T>::IsArithmetic;
 
     template <Arithmetic T, size_t N>
-    std::ostream& operator<<(std::ostream& os, const Vector<T, N>& vec);
-
-    template <Arithmetic T1, Arithmetic T2, size_t N>
-    auto operator+(const Vector<T1, N>& lhs, const Vector<T2, N>& rhs);
+    struct VectorStorage
+    {
+        static constexpr bool IsSimd = false;
+        static constexpr size_t Size = N;
+        static constexpr size_t Alignment = alignof(T);
+    };
 
-    template <Arithmetic T1, Arithmetic T2, size_t N>
-    auto operator-(const Vector<T1, N>& lhs, const Vector<T2, N>& rhs);
+    template <size_t N> requires (N >= 2 && N <= 4)
+    struct VectorStorage<float, N>
+    {
+        static constexpr bool IsSimd = true;
+        static constexpr size_t Size = N == 2 ? 2 : 4;
+        static constexpr size_t Alignment = N == 2 ? 8 : 16;
+    };
 
     template <Arithmetic T, size_t N>
     class Vector 
     {
         static_assert(N > 0, "Vector must have at least one dimension.");
 
+        using Storage = VectorStorage<T, N>;
+
     public:
         
         using value_type = T;
         using size_type = size_t;
-        using iterator = typename std::array<T, N>::iterator;
-        using const_iterator = typename std::array<T, N>::const_iterator;
+        using iterator = T*;
+        using const_iterator = const T*;
 
-        Vector() = default;
+        static constexpr bool IsSimd = Storage::IsSimd;
 
-		explicit Vector(T scalar)
-		{
-			std::unique_lock lock(*mutex);
-			std::fill(data.begin(), data.end(), scalar);
-		}
+        constexpr Vector() = default;
 
-        Vector(std::initializer_list<T> list) 
+        explicit constexpr Vector(T scalar)
         {
-            assert(list.size() == N && "Initializer list size must match vector dimensions.");
-
-            std::unique_lock lock(*mutex);
-            std::copy(list.begin(), list.end(), data.begin());
-        }
-
-        template <typename U, size_t M> requires (std::is_arithmetic_v<U> && M <= N)
-        Vector(const Vector<U, M>& other)
-        {
-            std::shared_lock lock_other(*other.mutex);
-            std::unique_lock lock(*mutex);
-
-            std::copy(other.begin(), other.end(), data.begin());
+            std::fill(begin(), end(), scalar);
         }
 
-		template <typename U, size_t M> requires (std::is_arithmetic_v<U>&& M <= N)
-        Vector(Vector<U, M>&& other) noexcept
+        constexpr Vector(std::initializer_list<T> list) 
         {
-			std::shared_lock lock_other(*other.mutex);
-			std::unique_lock lock(*mutex);
+            assert(list.size() == N && "Initializer list size must match vector dimensions.");
 
-			std::move(other.begin(), other.end(), data.begin());
+            std::copy(list.begin(), list.end(), data.begin());
         }
 
-        //Vector(const Vector& other) = default;
-
         template <Arithmetic U, size_t M> requires (M <= N)
-        Vector& operator=(const Vector<U, M>& other)
+        constexpr Vector(const Vector<U, M>& other)
         {
-            std::scoped_lock lock(*mutex, *other.mutex);
             std::copy(other.begin(), other.end(), data.begin());
-
-            return *this;
         }
 
         template <Arithmetic U, size_t M> requires (M <= N)
-        Vector& operator=(Vector<U, M>&& other) noexcept
+        constexpr Vector& operator=(const Vector<U, M>& other)
         {
-            std::scoped_lock lock(*mutex, *other.mutex);
-            std::move(other.begin(), other.end(), data.begin());
+            std::copy(other.begin(), other.end(), data.begin());
 
             return *this;
         }
 
-        T& operator[](size_t index) 
+        constexpr T& operator[](size_t index) 
         {
             assert(index < N && "Index out of bounds.");
-            std::shared_lock lock(*mutex);
 
             return data[index];
         }
 
-        const T& operator[](size_t index) const 
+        constexpr const T& operator[](size_t index) const 
         {
             assert(index < N && "Index out of bounds.");
-            std::shared_lock lock(*mutex);
 
             return data[index];
         }
 
-        iterator begin() 
+        constexpr iterator begin() 
         {
-            std::shared_lock lock(*mutex);
-            return data.begin();
+            return data.data();
         }
 
-        const_iterator begin() const 
+        constexpr const_iterator begin() const 
         {
-            std::shared_lock lock(*mutex);
-            return data.begin();
+            return data.data();
         }
 
-        iterator end() 
+        constexpr iterator end() 
         {
-            std::shared_lock lock(*mutex);
-            return data.end();
+            return data.data() + N;
         }
 
-        const_iterator end() const 
+        constexpr const_iterator end() const 
         {
-            std::shared_lock lock(*mutex);
-            return data.end();
+            return data.data() + N;
         }
 
-        Vector operator+(const Vector& other) const 
+        constexpr Vector operator+(const Vector& other) const 
         {
-            std::shared_lock lock(*mutex);
-            std::shared_lock lock_other(*other.mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Add(Load(), other.Load()));
+            }
 
             Vector result;
 
@@ -150,10 +139,13 @@ namespace Invasion::Math
             return result;
         }
 
-        Vector operator-(const Vector& other) const
+        constexpr Vector operator-(const Vector& other) const
         {
-            std::shared_lock lock(*mutex);
-            std::shared_lock lock_other(*other.mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Subtract(Load(), other.Load()));
+            }
 
             Vector result;
 
@@ -163,22 +155,29 @@ namespace Invasion::Math
             return result;
         }
 
-		Vector operator*(const Vector& other) const
-		{
-			std::shared_lock lock(*mutex);
-			std::shared_lock lock_other(*other.mutex);
+        constexpr Vector operator*(const Vector& other) const
+        {
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Multiply(Load(), other.Load()));
+            }
 
-			Vector result;
+            Vector result;
 
-			for (size_t i = 0; i < N; ++i)
-				result.data[i] = data[i] * other.data[i];
+            for (size_t i = 0; i < N; ++i)
+                result.data[i] = data[i] * other.data[i];
 
-			return result;
-		}
+            return result;
+        }
 
-        Vector operator*(T scalar) const 
+        constexpr Vector operator*(T scalar) const 
         {
-            std::shared_lock lock(*mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Multiply(Load(), Simd::Splat(scalar)));
+            }
 
             Vector result;
 
@@ -188,22 +187,29 @@ namespace Invasion::Math
             return result;
         }
 
-		Vector operator/(const Vector& other) const
-		{
-			std::shared_lock lock(*mutex);
-			std::shared_lock lock_other(*other.mutex);
+        constexpr Vector operator/(const Vector& other) const
+        {
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Divide(Load(), other.Load()));
+            }
 
-			Vector result;
+            Vector result;
 
-			for (size_t i = 0; i < N; ++i)
-				result.data[i] = data[i] / other.data[i];
+            for (size_t i = 0; i < N; ++i)
+                result.data[i] = data[i] / other.data[i];
 
-			return result;
-		}
+            return result;
+        }
 
-        Vector operator/(T scalar) const 
+        constexpr Vector operator/(T scalar) const 
         {
-            std::shared_lock lock(*mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Divide(Load(), Simd::Splat(scalar)));
+            }
 
             Vector result;
 
@@ -213,87 +219,59 @@ namespace Invasion::Math
             return result;
         }
 
-        Vector& operator+=(const Vector& other) 
+        constexpr Vector& operator+=(const Vector& other) 
         {
-            std::unique_lock lock(*mutex);
-            std::shared_lock lock_other(*other.mutex);
-
-            for (size_t i = 0; i < N; ++i) 
-                data[i] += other.data[i];
-            
-            return *this;
+            return *this = *this + other;
         }
 
-        Vector& operator-=(const Vector& other)
+        constexpr Vector& operator-=(const Vector& other)
         {
-            std::unique_lock lock(*mutex);
-            std::shared_lock lock_other(*other.mutex);
-
-            for (size_t i = 0; i < N; ++i) 
-                data[i] -= other.data[i];
-            
-            return *this;
+            return *this = *this - other;
         }
 
-        Vector& operator*=(const Vector& other)
+        constexpr Vector& operator*=(const Vector& other)
         {
-			std::unique_lock lock(*mutex);
-			std::shared_lock lock_other(*other.mutex);
-
-			for (size_t i = 0; i < N; ++i)
-				data[i] *= other.data[i];
-
-			return *this;
+            return *this = *this * other;
         }
 
-        Vector& operator*=(T scalar) 
+        constexpr Vector& operator*=(T scalar) 
         {
-            std::unique_lock lock(*mutex);
-
-            for (size_t i = 0; i < N; ++i) 
-                data[i] *= scalar;
-            
-            return *this;
+            return *this = *this * scalar;
         }
 
-		Vector& operator/=(const Vector& other)
+        constexpr Vector& operator/=(const Vector& other)
         {
-			std::unique_lock lock(*mutex);
-			std::shared_lock lock_other(*other.mutex);
-
-			for (size_t i = 0; i < N; ++i)
-				data[i] /= other.data[i];
-
-			return *this;
-		}
+            return *this = *this / other;
+        }
 
-        Vector& operator/=(T scalar) 
+        constexpr Vector& operator/=(T scalar) 
         {
-            std::unique_lock lock(*mutex);
-
-            for (size_t i = 0; i < N; ++i) 
-                data[i] /= scalar;
-            
-            return *this;
+            return *this = *this / scalar;
         }
 
-        bool operator==(const Vector& other) const 
+        constexpr bool operator==(const Vector& other) const 
         {
-            std::shared_lock lock(*mutex);
-            std::shared_lock lock_other(*other.mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Simd::Equal(Load(), other.Load(), N);
+            }
 
-            return data == other.data;
+            return std::equal(begin(), end(), other.begin());
         }
 
-        bool operator!=(const Vector& other) const 
+        constexpr bool operator!=(const Vector& other) const 
         {
             return !(*this == other);
         }
 
-        static T Dot(const Vector& a, const Vector& b) 
+        static constexpr T Dot(const Vector& a, const Vector& b) 
         {
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Simd::Dot(a.Load(), b.Load());
+            }
 
             T result = 0;
 
@@ -303,28 +281,15 @@ namespace Invasion::Math
             return result;
         }
 
-        template <Arithmetic U>
-        static auto Dot(const Vector<U, N>& a, const Vector<U, N>& b) 
-        {
-            using ReturnType = std::common_type_t<T, U>;
-
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
-
-            ReturnType result = 0;
-
-            for (size_t i = 0; i < N; ++i) 
-                result += static_cast<ReturnType>(a.data[i]) * static_cast<ReturnType>(b.data[i]);
-            
-            return result;
-        }
-
-        static Vector Cross(const Vector& a, const Vector& b)
+        static constexpr Vector Cross(const Vector& a, const Vector& b)
         {
             static_assert(N == 3, "Cross product is only defined for 3D vectors.");
 
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Cross(a.Load(), b.Load()));
+            }
 
             Vector result;
 
@@ -335,199 +300,142 @@ namespace Invasion::Math
             return result;
         }
 
-        static T Distance(const Vector& a, const Vector& b) 
+        static constexpr T Distance(const Vector& a, const Vector& b) 
         {
-            return std::sqrt(DistanceSquared(a, b));
+            return Scalar::Sqrt(DistanceSquared(a, b));
         }
 
-        static T DistanceSquared(const Vector& a, const Vector& b) 
+        static constexpr T DistanceSquared(const Vector& a, const Vector& b) 
         {
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
-
-            T result = 0;
-
-            for (size_t i = 0; i < N; ++i) 
-            {
-                T diff = a.data[i] - b.data[i];
-                result += diff * diff;
-            }
+            Vector difference = a - b;
 
-            return result;
+            return Dot(difference, difference);
         }
 
-        Vector Normalize() const 
+        constexpr Vector Normalize() const 
         {
-            std::shared_lock lock(*mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    Simd::Float4 value = Load();
 
-            T length = Length();
-            Vector result;
+                    return Store(Simd::Divide(value, Simd::Splat(std::sqrt(Simd::Dot(value, value)))));
+                }
+            }
 
-            for (size_t i = 0; i < N; ++i) 
-                result.data[i] = data[i] / length;
-            
-            return result;
+            return *this / Length();
         }
 
-        T Length() const 
+        constexpr T Length() const 
         {
-            return std::sqrt(Dot(*this, *this));
+            return Scalar::Sqrt(Dot(*this, *this));
         }
 
-        T LengthSquared() const 
+        constexpr T LengthSquared() const 
         {
             return Dot(*this, *this);
         }
 
-        static Vector Lerp(const Vector& a, const Vector& b, T t) 
+        static constexpr Vector Lerp(const Vector& a, const Vector& b, T t) 
         {
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
-
-            Vector result;
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::MultiplyAdd(Simd::Subtract(b.Load(), a.Load()), Simd::Splat(t), a.Load()));
+            }
 
-            for (size_t i = 0; i < N; ++i) 
-                result.data[i] = a.data[i] + (b.data[i] - a.data[i]) * t;
-            
-            return result;
+            return a + (b - a) * t;
         }
 
         static Vector Slerp(const Vector& a, const Vector& b, T t)
         {
             static_assert(N == 3, "Slerp is only defined for 3D vectors.");
 
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
-
-            T dot = Dot(a, b);
-
-            dot = std::clamp(dot, static_cast<T>(-1), static_cast<T>(1));
+            T dot = std::clamp(Dot(a, b), static_cast<T>(-1), static_cast<T>(1));
 
             T theta = std::acos(dot);
-            T sin_theta = std::sin(theta);
+            T sinTheta = std::sin(theta);
 
-            if (sin_theta == 0) 
+            if (sinTheta == 0) 
                 return a;
             
-            T factor_a = std::sin((1 - t) * theta) / sin_theta;
-            T factor_b = std::sin(t * theta) / sin_theta;
-
-            Vector result;
+            T factorA = std::sin((1 - t) * theta) / sinTheta;
+            T factorB = std::sin(t * theta) / sinTheta;
 
-            for (size_t i = 0; i < N; ++i) 
-                result.data[i] = a.data[i] * factor_a + b.data[i] * factor_b;
-            
-            return result;
+            return a * factorA + b * factorB;
         }
 
-        Vector Reflect(const Vector& normal) const 
+        constexpr Vector Reflect(const Vector& normal) const 
         {
-            std::shared_lock lock_a(*mutex);
-            std::shared_lock lock_n(*normal.mutex);
-
             return *this - normal * (2 * Dot(*this, normal));
         }
 
-        Vector Project(const Vector& b) const 
+        constexpr Vector Project(const Vector& b) const 
         {
-            std::shared_lock lock_a(*mutex);
-            std::shared_lock lock_b(*b.mutex);
-
-            T scalar = Dot(*this, b) / Dot(b, b);
-
-            return b * scalar;
+            return b * (Dot(*this, b) / Dot(b, b));
         }
 
-        Vector Reject(const Vector& b) const 
+        constexpr Vector Reject(const Vector& b) const 
         {
             return *this - Project(b);
         }
 
-        static Vector Min(const Vector& a, const Vector& b) 
+        static constexpr Vector Min(const Vector& a, const Vector& b) 
         {
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
-            Vector result;
-
-            for (size_t i = 0; i < N; ++i) 
-                result.data[i] = std::min(a.data[i], b.data[i]);
-            
-            return result;
-        }
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Min(a.Load(), b.Load()));
+            }
 
-        static Vector Max(const Vector& a, const Vector& b) 
-        {
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
-                result.data[i] = std::max(a.data[i], b.data[i]);
+                result.data[i] = std::min(a.data[i], b.data[i]);
             
             return result;
         }
 
-        static Vector Clamp(const Vector& a, const Vector& min, const Vector& max) 
+        static constexpr Vector Max(const Vector& a, const Vector& b) 
         {
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_min(*min.mutex);
-            std::shared_lock lock_max(*max.mutex);
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Max(a.Load(), b.Load()));
+            }
 
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
-                result.data[i] = std::clamp(a.data[i], min.data[i], max.data[i]);
+                result.data[i] = std::max(a.data[i], b.data[i]);
             
             return result;
         }
 
-        template <Arithmetic T1, Arithmetic T2, size_t N>
-        auto Dot(const Vector<T1, N>& a, const Vector<T2, N>& b)
+        static constexpr Vector Clamp(const Vector& a, const Vector& min, const Vector& max) 
         {
-            using ReturnType = std::common_type_t<T1, T2>;
-
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
-
-            ReturnType result = 0;
-
-            for (size_t i = 0; i < N; ++i)
-                result += static_cast<ReturnType>(a.data[i]) * static_cast<ReturnType>(b.data[i]);
-
-            return result;
+            return Min(Max(a, min), max);
         }
 
-        template <Arithmetic T1, Arithmetic T2>
-        auto Cross(const Vector<T1, 3>& a, const Vector<T2, 3>& b)
+        constexpr Vector Abs() const 
         {
-            using ReturnType = std::common_type_t<T1, T2>;
-
-            std::shared_lock lock_a(*a.mutex);
-            std::shared_lock lock_b(*b.mutex);
-
-            Vector<ReturnType, 3> result;
-
-            result.data[0] = static_cast<ReturnType>(a.data[1]) * static_cast<ReturnType>(b.data[2]) - static_cast<ReturnType>(a.data[2]) * static_cast<ReturnType>(b.data[1]);
-            result.data[1] = static_cast<ReturnType>(a.data[2]) * static_cast<ReturnType>(b.data[0]) - static_cast<ReturnType>(a.data[0]) * static_cast<ReturnType>(b.data[2]);
-            result.data[2] = static_cast<ReturnType>(a.data[0]) * static_cast<ReturnType>(b.data[1]) - static_cast<ReturnType>(a.data[1]) * static_cast<ReturnType>(b.data[0]);
-
-            return result;
-        }
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                    return Store(Simd::Abs(Load()));
+            }
 
-        Vector Abs() const 
-        {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
-                result.data[i] = std::abs(data[i]);
+                result.data[i] = Scalar::Abs(data[i]);
             
             return result;
         }
 
         Vector Floor() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -538,7 +446,6 @@ namespace Invasion::Math
 
         Vector Ceil() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -549,7 +456,6 @@ namespace Invasion::Math
 
         Vector Round() const
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -560,20 +466,11 @@ namespace Invasion::Math
 
         Vector Fract() const
         {
-            std::shared_lock lock(*mutex);
-            Vector result;
-
-            for (size_t i = 0; i < N; ++i) 
-                result.data[i] = data[i] - std::floor(data[i]);
-            
-            return result;
+            return *this - Floor();
         }
 
         Vector Mod(const Vector& other) const 
         {
-            std::shared_lock lock_a(*mutex);
-            std::shared_lock lock_b(other.mutex);
-
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -584,7 +481,6 @@ namespace Invasion::Math
 
         Vector Mod(T scalar) const
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -593,43 +489,62 @@ namespace Invasion::Math
             return result;
         }
 
-        Vector Sin() const 
+        constexpr Vector Sin() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
-                result.data[i] = std::sin(data[i]);
+                result.data[i] = Scalar::Sin(data[i]);
             
             return result;
         }
 
-        Vector Cos() const 
+        constexpr Vector Cos() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
-                result.data[i] = std::cos(data[i]);
+                result.data[i] = Scalar::Cos(data[i]);
             
             return result;
         }
 
-        Vector Tan() const 
+        static constexpr void SinCos(const Vector& angles, Vector& sine, Vector& cosine)
+        {
+#ifdef INVASION_MATH_FAST_TRIG
+            if constexpr (IsSimd)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    Simd::Float4 sineLanes, cosineLanes;
+
+                    Simd::SinCos4(angles.Load(), sineLanes, cosineLanes);
+
+                    sine = Store(sineLanes);
+                    cosine = Store(cosineLanes);
+
+                    return;
+                }
+            }
+#endif
+            for (size_t i = 0; i < N; ++i)
+                Scalar::SinCos(angles.data[i], sine.data[i], cosine.data[i]);
+        }
+
+        constexpr Vector Tan() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
-                result.data[i] = std::tan(data[i]);
+                result.data[i] = Scalar::Tan(data[i]);
             
             return result;
         }
 
         Vector Asin() const
         {
-            std::shared_lock lock(*mutex);
             Vector result;
+
             for (size_t i = 0; i < N; ++i) 
                 result.data[i] = std::asin(data[i]);
             
@@ -638,7 +553,6 @@ namespace Invasion::Math
 
         Vector Acos() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -649,7 +563,6 @@ namespace Invasion::Math
 
         Vector Atan() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -662,9 +575,6 @@ namespace Invasion::Math
         {
             static_assert(N == 3, "Atan2 is typically used with 3D vectors.");
 
-            std::shared_lock lock_y(*y.mutex);
-            std::shared_lock lock_x(*x.mutex);
-
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -675,7 +585,6 @@ namespace Invasion::Math
 
         Vector Sinh() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -686,7 +595,6 @@ namespace Invasion::Math
 
         Vector Cosh() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -697,7 +605,6 @@ namespace Invasion::Math
 
         Vector Tanh() const 
         {
-            std::shared_lock lock(*mutex);
             Vector result;
 
             for (size_t i = 0; i < N; ++i) 
@@ -706,6 +613,7 @@ namespace Invasion::Math
             return result;
         }
 
+#ifdef DIRECTX_MATH_VERSION
         operator DirectX::XMFLOAT2() const requires (N == 2) 
         {
             return DirectX::XMFLOAT2(static_cast<float>(data[0]), static_cast<float>(data[1]));
@@ -720,31 +628,41 @@ namespace Invasion::Math
         {
             return DirectX::XMFLOAT4(static_cast<float>(data[0]), static_cast<float>(data[1]), static_cast<float>(data[2]), static_cast<float>(data[3]));
         }
+#endif
+
+    private:
 
-        friend std::ostream& operator<< <T, N>(std::ostream& os, const Vector& vec);
+        Simd::Float4 Load() const
+        {
+            return Simd::Load<N>(data.data());
+        }
 
-        template <Arithmetic T1, Arithmetic T2, size_t X>
-        friend auto operator+(const Vector& lhs, const Vector& rhs);
+        static Vector Store(Simd::Float4 value)
+        {
+            Vector result;
 
-        template <Arithmetic T1, Arithmetic T2, size_t X>
-        friend auto operator-(const Vector& lhs, const Vector& rhs);
+            Simd::Store<N>(result.data.data(), value);
 
-    private:
+            return result;
+        }
 
-        std::array<T, N> data{};
-        mutable std::shared_ptr<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
+        alignas(Storage::Alignment) std::array<T, Storage::Size> data{};
 
     };
 
+    static_assert(std::is_trivially_copyable_v<Vector<float, 2>>);
+    static_assert(std::is_trivially_copyable_v<Vector<float, 3>>);
+    static_assert(std::is_trivially_copyable_v<Vector<float, 4>>);
+
     template <Arithmetic T, size_t N>
     std::ostream& operator<<(std::ostream& os, const Vector<T, N>& vec) 
     {
-        std::shared_lock lock(*vec.mutex);
-
         os << "(";
 
-        for (size_t i = 0; i < N; ++i) {
-            os << vec.data[i];
+        for (size_t i = 0; i < N; ++i) 
+        {
+            os << vec[i];
+
             if (i != N - 1) 
                 os << ", ";
         }
@@ -754,34 +672,54 @@ namespace Invasion::Math
     }
 
     template <Arithmetic T1, Arithmetic T2, size_t N>
-    auto operator+(const Vector<T1, N>& lhs, const Vector<T2, N>& rhs) 
+    constexpr auto operator+(const Vector<T1, N>& lhs, const Vector<T2, N>& rhs) 
     {
         using ReturnType = std::common_type_t<T1, T2>;
 
         Vector<ReturnType, N> result;
 
-        std::shared_lock lock_lhs(*lhs.mutex);
-        std::shared_lock lock_rhs(*rhs.mutex);
-
         for (size_t i = 0; i < N; ++i) 
-            result.data[i] = static_cast<ReturnType>(lhs.data[i]) + static_cast<ReturnType>(rhs.data[i]);
+            result[i] = static_cast<ReturnType>(lhs[i]) + static_cast<ReturnType>(rhs[i]);
         
         return result;
     }
 
     template <Arithmetic T1, Arithmetic T2, size_t N>
-    auto operator-(const Vector<T1, N>& lhs, const Vector<T2, N>& rhs) 
+    constexpr auto operator-(const Vector<T1, N>& lhs, const Vector<T2, N>& rhs) 
     {
         using ReturnType = std::common_type_t<T1, T2>;
 
         Vector<ReturnType, N> result;
 
-        std::shared_lock lock_lhs(*lhs.mutex);
-        std::shared_lock lock_rhs(*rhs.mutex);
-
         for (size_t i = 0; i < N; ++i) 
-            result.data[i] = static_cast<ReturnType>(lhs.data[i]) - static_cast<ReturnType>(rhs.data[i]);
+            result[i] = static_cast<ReturnType>(lhs[i]) - static_cast<ReturnType>(rhs[i]);
         
         return result;
     }
+
+    template <Arithmetic T1, Arithmetic T2, size_t N>
+    constexpr auto Dot(const Vector<T1, N>& a, const Vector<T2, N>& b)
+    {
+        using ReturnType = std::common_type_t<T1, T2>;
+
+        if constexpr (std::same_as<T1, T2>)
+            return Vector<T1, N>::Dot(a, b);
+        else
+        {
+            ReturnType result = 0;
+
+            for (size_t i = 0; i < N; ++i)
+                result += static_cast<ReturnType>(a[i]) * static_cast<ReturnType>(b[i]);
+
+            return result;
+        }
+    }
+
+    template <Arithmetic T1, Arithmetic T2>
+    constexpr auto Cross(const Vector<T1, 3>& a, const Vector<T2, 3>& b)
+    {
+        using ReturnType = std::common_type_t<T1, T2>;
+
+        return Vector<ReturnType, 3>::Cross(Vector<ReturnType, 3>(a), Vector<ReturnType, 3>(b));
+    }
 };
\ No newline at end of file
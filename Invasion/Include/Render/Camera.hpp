@@ -2,6 +2,7 @@
 
 #include "pch.h"
 #include "ECS/GameObject.hpp"
+#include "Math/Frustum.hpp"
 
 using namespace winrt::Windows::UI::Core;
 
@@ -26,11 +27,43 @@ namespace Invasion::Render
 
 		Matrix<float, 4, 4> GetViewMatrix() const
 		{
-			Vector<float, 3> position = GetGameObject()->GetTransform()->GetWorldPosition();
-			Vector<float, 3> forward = GetGameObject()->GetTransform()->GetForward();
-			Vector<float, 3> up = { 0.0f, 1.0f, 0.0f };
+			Shared<Transform> transform = GetGameObject()->GetTransform();
 
-			return Matrix<float, 4, 4>::LookAt(position, position + forward, up);
+			uint32_t version = transform->GetWorldVersion();
+
+			{
+				std::shared_lock lock(*mutex);
+
+				if (version == viewVersion)
+					return viewMatrix;
+			}
+
+			Vector<float, 3> position = transform->GetWorldPosition();
+			Vector<float, 3> forward = transform->GetForward();
+
+			Matrix<float, 4, 4> result = Matrix<float, 4, 4>::LookAt(position, position + forward, Up);
+
+			std::unique_lock lock(*mutex);
+
+			viewMatrix = result;
+			viewVersion = version;
+
+			return result;
+		}
+
+		uint64_t GetId() const
+		{
+			return id;
+		}
+
+		uint32_t GetViewVersion() const
+		{
+			return GetGameObject()->GetTransform()->GetWorldVersion();
+		}
+
+		Frustum GetFrustum() const
+		{
+			return Frustum::FromMatrix(GetViewMatrix() * GetProjectionMatrix());
 		}
 
 		static Shared<Camera> Create(float fieldOfView, float nearPlane, float farPlane)
@@ -48,9 +81,22 @@ namespace Invasion::Render
 
 		Camera() = default;
 
+		static constexpr Vector<float, 3> Up = { 0.0f, 1.0f, 0.0f };
+
 		float fieldOfView = 0;
 		float nearPlane = 0;
 		float farPlane = 0;
 
+		const uint64_t id = ++nextId;
+
+		Shared<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
+
+		mutable Matrix<float, 4, 4> viewMatrix;
+		mutable uint32_t viewVersion = 0;
+
+		static std::atomic<uint64_t> nextId;
+
 	};
+
+	std::atomic<uint64_t> Camera::nextId = 0;
 }
\ No newline at end of file
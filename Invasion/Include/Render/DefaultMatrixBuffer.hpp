@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include "Math/Matrix.hpp"
+
+namespace Invasion::Render
+{
+	struct alignas(16) DefaultMatrixBuffer
+	{
+		Math::Matrix<float, 4, 4> projectionMatrix;
+		Math::Matrix<float, 4, 4> viewMatrix;
+		Math::Matrix<float, 4, 4> modelMatrix;
+		Math::Matrix<float, 4, 4> normalMatrix;
+	};
+
+	static_assert(sizeof(Math::Matrix<float, 4, 4>) == 16 * sizeof(float));
+	static_assert(sizeof(DefaultMatrixBuffer) == 4 * sizeof(Math::Matrix<float, 4, 4>) && sizeof(DefaultMatrixBuffer) % 16 == 0);
+	static_assert(offsetof(DefaultMatrixBuffer, normalMatrix) == 3 * sizeof(Math::Matrix<float, 4, 4>));
+}
\ No newline at end of file
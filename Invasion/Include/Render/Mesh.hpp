@@ -3,6 +3,7 @@
 #include <d3d11_4.h>
 #include <dxgi1_6.h>
 #include "ECS/GameObject.hpp"
+#include "Render/DefaultMatrixBuffer.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/Shader.hpp"
 #include "Render/Texture.hpp"
@@ -14,13 +15,6 @@ using namespace Invasion::Util;
 
 namespace Invasion::Render
 {
-	struct DefaultMatrixBuffer
-	{
-		DirectX::XMMATRIX projectionMatrix;
-		DirectX::XMMATRIX viewMatrix;
-		DirectX::XMMATRIX modelMatrix;
-	};
-
 	class Mesh : public Component
 	{
 
@@ -48,13 +42,16 @@ namespace Invasion::Render
 				D3D11_SUBRESOURCE_DATA subresourceData = {};
 				subresourceData.pSysMem = vertices;
 
-				device->CreateBuffer(&bufferDescription, &subresourceData, vertexBuffer.GetAddressOf());
+				if (FAILED(device->CreateBuffer(&bufferDescription, &subresourceData, vertexBuffer.GetAddressOf())))
+					throw std::runtime_error("Failed to create mesh vertex buffer");
 			}
 			else
 			{
 				D3D11_MAPPED_SUBRESOURCE mappedResource;
 
-				context->Map(vertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+				if (FAILED(context->Map(vertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
+					throw std::runtime_error("Failed to map mesh vertex buffer");
+
 				memcpy(mappedResource.pData, vertices, sizeof(Vertex) * vertices.Length());
 				context->Unmap(vertexBuffer.Get(), 0);
 			}
@@ -71,13 +68,16 @@ namespace Invasion::Render
 				D3D11_SUBRESOURCE_DATA subresourceData = {};
 				subresourceData.pSysMem = indices;
 
-				device->CreateBuffer(&bufferDescription, &subresourceData, indexBuffer.GetAddressOf());
+				if (FAILED(device->CreateBuffer(&bufferDescription, &subresourceData, indexBuffer.GetAddressOf())))
+					throw std::runtime_error("Failed to create mesh index buffer");
 			}
 			else
 			{
 				D3D11_MAPPED_SUBRESOURCE mappedResource;
 
-				context->Map(indexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+				if (FAILED(context->Map(indexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
+					throw std::runtime_error("Failed to map mesh index buffer");
+
 				memcpy(mappedResource.pData, indices, sizeof(uint32_t) * indices.Length());
 				context->Unmap(indexBuffer.Get(), 0);
 			}
@@ -85,7 +85,7 @@ namespace Invasion::Render
 
 		void Render(const Shared<Invasion::Render::Camera>& camera) override
 		{
-			std::shared_lock lock(*mutex);
+			std::unique_lock lock(*mutex);
 
 			ComPtr<ID3D11DeviceContext4> context = Renderer::GetInstance().GetContext();
 
@@ -100,12 +100,9 @@ namespace Invasion::Render
 			context->IASetIndexBuffer(indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
 			context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-			shader->SetConstantBuffer(SubShaderType::VERTEX, 0, DefaultMatrixBuffer
-			{
-				camera->GetProjectionMatrix(),
-				camera->GetViewMatrix(),
-				transform->GetModelMatrix() 
-			});
+			UploadMatrices(camera, transform);
+
+			shader->SetConstantBuffer(SubShaderType::VERTEX, 0, constantBuffer);
 
 			shader->Bind();
 			texture->Bind();
@@ -113,26 +110,26 @@ namespace Invasion::Render
 			context->DrawIndexed((UINT)indices.Length(), 0, 0);
 		}
 
-		void SetVertices(const MutableArray<Vertex>& vertices)
+		void SetVertices(const LocalArray<Vertex>& vertices)
 		{
 			std::unique_lock lock(*mutex);
 
 			this->vertices = vertices;
 		}
 
-		void SetIndices(const MutableArray<uint32_t>& indices)
+		void SetIndices(const LocalArray<uint32_t>& indices)
 		{
 			std::unique_lock lock(*mutex);
 
 			this->indices = indices;
 		}
 
-		MutableArray<Vertex> GetVertices() const
+		LocalArray<Vertex> GetVertices() const
 		{
 			return vertices;
 		}
 
-		MutableArray<uint32_t> GetIndices() const
+		LocalArray<uint32_t> GetIndices() const
 		{
 			return indices;
 		}
@@ -145,7 +142,7 @@ namespace Invasion::Render
 			indexBuffer.Reset();
 		}
 
-		static Shared<Mesh> Create(const MutableArray<Vertex>& vertices, const MutableArray<uint32_t>& indices)
+		static Shared<Mesh> Create(const LocalArray<Vertex>& vertices, const LocalArray<uint32_t>& indices)
 		{
 			Shared<Mesh> result(new Mesh());
 
@@ -159,13 +156,73 @@ namespace Invasion::Render
 		
 		Mesh() = default;
 
+		void UploadMatrices(const Shared<Invasion::Render::Camera>& camera, const Shared<Transform>& transform)
+		{
+			Matrix<float, 4, 4> projectionMatrix = camera->GetProjectionMatrix();
+
+			uint32_t viewVersion = camera->GetViewVersion();
+			uint32_t transformVersion = transform->GetWorldVersion();
+
+			if (constantBuffer && camera->GetId() == uploadedCameraId && viewVersion == uploadedViewVersion && transformVersion == uploadedTransformVersion && projectionMatrix == uploadedProjectionMatrix)
+				return;
+
+			DefaultMatrixBuffer matrices
+			{
+				projectionMatrix,
+				camera->GetViewMatrix(),
+				transform->GetModelMatrix(),
+				transform->GetNormalMatrix()
+			};
+
+			if (!constantBuffer)
+			{
+				D3D11_BUFFER_DESC bufferDescription = {};
+
+				bufferDescription.Usage = D3D11_USAGE_DYNAMIC;
+				bufferDescription.ByteWidth = sizeof(DefaultMatrixBuffer);
+				bufferDescription.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+				bufferDescription.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+				D3D11_SUBRESOURCE_DATA subresourceData = {};
+				subresourceData.pSysMem = &matrices;
+
+				if (FAILED(Renderer::GetInstance().GetDevice()->CreateBuffer(&bufferDescription, &subresourceData, constantBuffer.GetAddressOf())))
+					throw std::runtime_error("Failed to create mesh matrix buffer");
+			}
+			else
+			{
+				ComPtr<ID3D11DeviceContext4> context = Renderer::GetInstance().GetContext();
+
+				D3D11_MAPPED_SUBRESOURCE mappedResource;
+
+				if (FAILED(context->Map(constantBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
+					throw std::runtime_error("Failed to map mesh matrix buffer");
+
+				memcpy(mappedResource.pData, &matrices, sizeof(DefaultMatrixBuffer));
+				context->Unmap(constantBuffer.Get(), 0);
+			}
+
+			uploadedCameraId = camera->GetId();
+			uploadedViewVersion = viewVersion;
+			uploadedTransformVersion = transformVersion;
+			uploadedProjectionMatrix = projectionMatrix;
+		}
+
 		Shared<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
 
-		MutableArray<Vertex> vertices;
-		MutableArray<uint32_t> indices;
+		LocalArray<Vertex> vertices;
+		LocalArray<uint32_t> indices;
 
 		ComPtr<ID3D11Buffer> vertexBuffer;
 		ComPtr<ID3D11Buffer> indexBuffer;
+		ComPtr<ID3D11Buffer> constantBuffer;
+
+		uint64_t uploadedCameraId = 0;
+
+		uint32_t uploadedViewVersion = 0;
+		uint32_t uploadedTransformVersion = 0;
+
+		Matrix<float, 4, 4> uploadedProjectionMatrix;
 
 	};
 }
\ No newline at end of file
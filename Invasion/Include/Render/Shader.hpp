@@ -41,7 +41,7 @@ namespace Invasion::Render
 
 			context->IASetInputLayout(inputLayout.Get());
 
-			constantBuffers.ForEach([&](const Tuple<SubShaderType, uint32_t>& key, const ComPtr<ID3D11Buffer>& value)
+			for (const auto& [key, value] : constantBuffers.Read())
 			{
 				if (key.Get<0>() == SubShaderType::VERTEX)
 					context->VSSetConstantBuffers(key.Get<1>(), 1, value.GetAddressOf());
@@ -55,9 +55,9 @@ namespace Invasion::Render
 					context->GSSetConstantBuffers(key.Get<1>(), 1, value.GetAddressOf());
 				else if (key.Get<0>() == SubShaderType::COMPUTE)
 					context->CSSetConstantBuffers(key.Get<1>(), 1, value.GetAddressOf());
-			});
+			}
 
-			shaderResourceViews.ForEach([&](const Tuple<SubShaderType, uint32_t>& key, const ComPtr<ID3D11ShaderResourceView>& value)
+			for (const auto& [key, value] : shaderResourceViews.Read())
 			{
 				if (key.Get<0>() == SubShaderType::VERTEX)
 					context->VSSetShaderResources(key.Get<1>(), 1, value.GetAddressOf());
@@ -71,9 +71,9 @@ namespace Invasion::Render
 					context->GSSetShaderResources(key.Get<1>(), 1, value.GetAddressOf());
 				else if (key.Get<0>() == SubShaderType::COMPUTE)
 					context->CSSetShaderResources(key.Get<1>(), 1, value.GetAddressOf());
-			});
+			}
 
-			samplerStates.ForEach([&](const Tuple<SubShaderType, uint32_t>& key, const ComPtr<ID3D11SamplerState>& value)
+			for (const auto& [key, value] : samplerStates.Read())
 			{
 				if (key.Get<0>() == SubShaderType::VERTEX)
 					context->VSSetSamplers(key.Get<1>(), 1, value.GetAddressOf());
@@ -87,7 +87,7 @@ namespace Invasion::Render
 					context->GSSetSamplers(key.Get<1>(), 1, value.GetAddressOf());
 				else if (key.Get<0>() == SubShaderType::COMPUTE)
 					context->CSSetSamplers(key.Get<1>(), 1, value.GetAddressOf());
-			});
+			}
 
 			context->VSSetShader(vertexShader.Get(), nullptr, 0);
 			context->PSSetShader(pixelShader.Get(), nullptr, 0);
@@ -153,7 +153,7 @@ namespace Invasion::Render
 			samplerStates[{type, slot}] = sampler;
 		}
 		
-		NarrowString GetName() const
+		Name GetName() const
 		{
 			return name;
 		}
@@ -329,7 +329,7 @@ namespace Invasion::Render
 				return E_FAIL;
 		}
 
-		NarrowString name;
+		Name name;
 
 		AssetPath path;  
 
@@ -17,15 +17,27 @@ namespace Invasion::Render
 			shaders |= { shader->GetName(), shader };
 		}
 
-		Shared<Shader> Get(const NarrowString& name)
+		Shared<Shader> Get(const Name& name)
 		{
-			return shaders[name];
+			return shaders.Get(name);
 		}
 
-		void Unregister(const NarrowString& name)
+		template <typename Key> requires std::constructible_from<Name, const Key&>
+		Shared<Shader> Get(const Key& name)
 		{
-			shaders[name]->Uninitialize_NoOverride();
-			shaders -= name;
+			return shaders.Get(Name::Find(name));
+		}
+
+		void Unregister(const Name& name)
+		{
+			if (auto shader = shaders.Extract(name))
+				(*shader)->Uninitialize_NoOverride();
+		}
+
+		template <typename Key> requires std::constructible_from<Name, const Key&>
+		void Unregister(const Key& name)
+		{
+			Unregister(Name::Find(name));
 		}
 
 		void Uninitialize()
@@ -50,7 +62,7 @@ namespace Invasion::Render
 
 		ShaderManager() = default;
 
-		UnorderedMap<NarrowString, Shared<Shader>> shaders;
+		ConcurrentMap<Name, Shared<Shader>> shaders;
 
 		static Unique<ShaderManager> instance;
 		static std::once_flag initFlag;
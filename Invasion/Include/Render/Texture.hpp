@@ -28,7 +28,7 @@ namespace Invasion::Render
 			Renderer::GetInstance().GetContext()->PSSetSamplers(slot, 1, samplerState.GetAddressOf());
 		}
 
-		NarrowString GetName() const
+		Name GetName() const
 		{
 			return name;
 		}
@@ -84,7 +84,7 @@ namespace Invasion::Render
                 throw std::runtime_error(NarrowString("Failed to create sampler state for texture: ") + fullPath);
         }
 
-		NarrowString name;
+		Name name;
 
 		AssetPath path;
 
@@ -17,15 +17,27 @@ namespace Invasion::Render
 			textures |= { texture->GetName(), texture };
 		}
 
-		Shared<Texture> Get(const NarrowString& name)
+		Shared<Texture> Get(const Name& name)
 		{
-			return textures[name];
+			return textures.Get(name);
 		}
 
-		void Unregister(const NarrowString& name)
+		template <typename Key> requires std::constructible_from<Name, const Key&>
+		Shared<Texture> Get(const Key& name)
 		{
-			textures[name]->Uninitialize_NoOverride();
-			textures -= name;
+			return textures.Get(Name::Find(name));
+		}
+
+		void Unregister(const Name& name)
+		{
+			if (auto texture = textures.Extract(name))
+				(*texture)->Uninitialize_NoOverride();
+		}
+
+		template <typename Key> requires std::constructible_from<Name, const Key&>
+		void Unregister(const Key& name)
+		{
+			Unregister(Name::Find(name));
 		}
 
 		void Uninitialize()
@@ -50,7 +62,7 @@ namespace Invasion::Render
 
 		TextureManager() = default;
 
-		UnorderedMap<NarrowString, Shared<Texture>> textures;
+		ConcurrentMap<Name, Shared<Texture>> textures;
 
 		static Unique<TextureManager> instance;
 		static std::once_flag initFlag;
@@ -14,13 +14,8 @@ namespace Invasion::Render
 	{
 		Vertex() = default;
 
-		Vertex(const Vector<float, 3>& position, const Vector<float, 3>& color, const Vector<float, 3>& normal, const Vector<float, 2>& uvs)
-		{
-			this->position = position;
-			this->color = color;
-			this->normal = normal;
-			this->uvs = uvs;
-		}
+		constexpr Vertex(const Vector<float, 3>& position, const Vector<float, 3>& color, const Vector<float, 3>& normal, const Vector<float, 2>& uvs)
+			: position(position[0], position[1], position[2]), color(color[0], color[1], color[2]), normal(normal[0], normal[1], normal[2]), uvs(uvs[0], uvs[1]) { }
 
 		static ImmutableArray<D3D11_INPUT_ELEMENT_DESC, 4> GetInputLayout()
 		{
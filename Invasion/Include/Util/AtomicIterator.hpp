@@ -8,7 +8,7 @@
 
 namespace Invasion::Util
 {
-    template <typename Iterator>
+    template <typename Iterator, typename Mutex = std::shared_mutex>
     class AtomicIterator 
     {
 
@@ -20,7 +20,7 @@ namespace Invasion::Util
         using pointer = typename std::iterator_traits<Iterator>::pointer;
         using reference = typename std::iterator_traits<Iterator>::reference;
 
-        AtomicIterator(Iterator it, std::shared_ptr<std::shared_mutex> mtx) : iter_(it), mutex_(mtx) {}
+        AtomicIterator(Iterator it, std::shared_ptr<Mutex> mtx) : iter_(it), mutex_(mtx) {}
 
         AtomicIterator() = delete;
 
@@ -110,6 +110,6 @@ namespace Invasion::Util
 
     private:
         Iterator iter_;
-        std::shared_ptr<std::shared_mutex> mutex_;
+        std::shared_ptr<Mutex> mutex_;
     };
 }
\ No newline at end of file
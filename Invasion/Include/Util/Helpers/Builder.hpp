@@ -1,6 +1,6 @@
 #pragma once
 
-#include <type_traits>x
+#include <type_traits>
 #include <string>
 #include "Util/Typedefs.hpp"
 
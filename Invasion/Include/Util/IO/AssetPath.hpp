@@ -1,6 +1,5 @@
 #pragma once
 
-#include <format>
 #include "Util/Typedefs.hpp"
 
 namespace Invasion::Util::IO
@@ -33,7 +32,13 @@ namespace Invasion::Util::IO
 
 		NarrowString GetFullPath() const
 		{
-			return std::format("Assets/{}/{}", domain, localPath);
+			NarrowString result = "Assets/";
+
+			result += domain;
+			result += "/";
+			result += localPath;
+
+			return result;
 		}
 
 	private:
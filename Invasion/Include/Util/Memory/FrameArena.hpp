@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include "Util/Typedefs.hpp"
+
+namespace Invasion::Util::Memory
+{
+	class FrameArena : public std::pmr::memory_resource
+	{
+
+	public:
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		~FrameArena() override
+		{
+			while (head)
+			{
+				Block* next = head->next;
+
+				::operator delete(head, sizeof(Block) + head->capacity, std::align_val_t(alignof(std::max_align_t)));
+
+				head = next;
+			}
+		}
+
+		void Reset() noexcept
+		{
+			std::unique_lock lock(mutex);
+
+			current = head;
+			offset = 0;
+		}
+
+		[[nodiscard]] size_t GetCapacity() const noexcept
+		{
+			std::unique_lock lock(mutex);
+
+			size_t capacity = 0;
+
+			for (Block* block = head; block; block = block->next)
+				capacity += block->capacity;
+
+			return capacity;
+		}
+
+		static FrameArena& GetInstance()
+		{
+			std::call_once(initFlag, []()
+			{
+				instance.reset(new FrameArena);
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		struct alignas(std::max_align_t) Block
+		{
+			Block* next;
+			size_t capacity;
+
+			std::byte* GetData() noexcept
+			{
+				return reinterpret_cast<std::byte*>(this + 1);
+			}
+		};
+
+		FrameArena() = default;
+
+		void* do_allocate(size_t bytes, size_t alignment) override
+		{
+			std::unique_lock lock(mutex);
+
+			while (true)
+			{
+				if (current)
+				{
+					uintptr_t base = reinterpret_cast<uintptr_t>(current->GetData());
+					size_t aligned = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+
+					if (aligned + bytes <= current->capacity)
+					{
+						offset = aligned + bytes;
+
+						return current->GetData() + aligned;
+					}
+
+					if (current->next)
+					{
+						current = current->next;
+						offset = 0;
+
+						continue;
+					}
+				}
+
+				AppendBlock(bytes + alignment);
+			}
+		}
+
+		void do_deallocate(void*, size_t, size_t) override { }
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+
+		void AppendBlock(size_t minimum)
+		{
+			size_t capacity = tail ? tail->capacity * 2 : BlockSize;
+
+			while (capacity < minimum)
+				capacity *= 2;
+
+			Block* block = static_cast<Block*>(::operator new(sizeof(Block) + capacity, std::align_val_t(alignof(std::max_align_t))));
+
+			block->next = nullptr;
+			block->capacity = capacity;
+
+			if (tail)
+				tail->next = block;
+			else
+				head = block;
+
+			tail = block;
+			current = block;
+			offset = 0;
+		}
+
+		static constexpr size_t BlockSize = 64 * 1024;
+
+		Block* head = nullptr;
+		Block* tail = nullptr;
+		Block* current = nullptr;
+
+		size_t offset = 0;
+
+		mutable Types::SpinMutex mutex;
+
+		static Unique<FrameArena> instance;
+		static std::once_flag initFlag;
+	};
+
+	Unique<FrameArena> FrameArena::instance;
+	std::once_flag FrameArena::initFlag;
+}
\ No newline at end of file
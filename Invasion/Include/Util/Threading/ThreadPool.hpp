@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Invasion::Util::Threading
+{
+	class ThreadPool
+	{
+
+	public:
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		~ThreadPool()
+		{
+			{
+				std::unique_lock lock(mutex);
+
+				isRunning = false;
+			}
+
+			wakeCondition.notify_all();
+
+			for (auto& worker : workers)
+				worker.join();
+		}
+
+		template <typename Function>
+		void ParallelFor(size_t count, size_t grainSize, Function&& function)
+		{
+			grainSize = std::max<size_t>(grainSize, 1);
+
+			size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+			if (chunkCount <= 1 || workers.empty())
+			{
+				if (count > 0)
+					function(size_t{ 0 }, count);
+
+				return;
+			}
+
+			std::unique_lock dispatchLock(dispatchMutex);
+
+			Job job;
+
+			job.invoke = &Invoke<std::remove_reference_t<Function>>;
+			job.function = const_cast<void*>(static_cast<const void*>(std::addressof(function)));
+			job.count = count;
+			job.grainSize = grainSize;
+			job.chunkCount = chunkCount;
+			job.remaining = chunkCount;
+
+			{
+				std::unique_lock lock(mutex);
+
+				currentJob = &job;
+				++generation;
+			}
+
+			wakeCondition.notify_all();
+
+			RunChunks(job);
+
+			std::unique_lock lock(mutex);
+
+			doneCondition.wait(lock, [&]() { return job.remaining.load(std::memory_order_acquire) == 0 && job.activeWorkers == 0; });
+
+			currentJob = nullptr;
+
+			if (job.exception)
+				std::rethrow_exception(job.exception);
+		}
+
+		size_t GetThreadCount() const noexcept
+		{
+			return workers.size() + 1;
+		}
+
+		static std::unique_ptr<ThreadPool> Create(size_t threadCount)
+		{
+			return std::unique_ptr<ThreadPool>(new ThreadPool(threadCount));
+		}
+
+		static ThreadPool& GetInstance()
+		{
+			std::call_once(initFlag, []()
+			{
+				instance.reset(new ThreadPool(std::max<size_t>(std::thread::hardware_concurrency(), 1)));
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		struct Job
+		{
+			void (*invoke)(void*, size_t, size_t) = nullptr;
+			void* function = nullptr;
+
+			size_t count = 0;
+			size_t grainSize = 0;
+			size_t chunkCount = 0;
+
+			std::atomic<size_t> nextChunk = 0;
+			std::atomic<size_t> remaining = 0;
+
+			size_t activeWorkers = 0;
+
+			std::exception_ptr exception;
+		};
+
+		explicit ThreadPool(size_t threadCount)
+		{
+			for (size_t i = 1; i < threadCount; ++i)
+				workers.emplace_back([this]() { WorkerLoop(); });
+		}
+
+		template <typename Function>
+		static void Invoke(void* function, size_t begin, size_t end)
+		{
+			(*static_cast<Function*>(function))(begin, end);
+		}
+
+		void RunChunks(Job& job)
+		{
+			size_t chunk;
+
+			while ((chunk = job.nextChunk.fetch_add(1, std::memory_order_relaxed)) < job.chunkCount)
+			{
+				size_t begin = chunk * job.grainSize;
+
+				try
+				{
+					job.invoke(job.function, begin, std::min(begin + job.grainSize, job.count));
+				}
+				catch (...)
+				{
+					std::unique_lock lock(mutex);
+
+					if (!job.exception)
+						job.exception = std::current_exception();
+				}
+
+				if (job.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					std::unique_lock lock(mutex);
+
+					doneCondition.notify_all();
+				}
+			}
+		}
+
+		void WorkerLoop()
+		{
+			size_t seen = 0;
+
+			std::unique_lock lock(mutex);
+
+			while (true)
+			{
+				wakeCondition.wait(lock, [&]() { return !isRunning || generation != seen; });
+
+				if (!isRunning)
+					return;
+
+				seen = generation;
+
+				Job* job = currentJob;
+
+				if (!job)
+					continue;
+
+				++job->activeWorkers;
+
+				lock.unlock();
+
+				RunChunks(*job);
+
+				lock.lock();
+
+				if (--job->activeWorkers == 0)
+					doneCondition.notify_all();
+			}
+		}
+
+		std::vector<std::thread> workers;
+
+		std::mutex dispatchMutex;
+		std::mutex mutex;
+
+		std::condition_variable wakeCondition;
+		std::condition_variable doneCondition;
+
+		Job* currentJob = nullptr;
+
+		size_t generation = 0;
+		bool isRunning = true;
+
+		static std::unique_ptr<ThreadPool> instance;
+		static std::once_flag initFlag;
+	};
+
+	std::unique_ptr<ThreadPool> ThreadPool::instance;
+	std::once_flag ThreadPool::initFlag;
+}
\ No newline at end of file
@@ -1,21 +1,55 @@
 #pragma once
 
+#ifdef _WIN32
 #include <wrl.h>
+#endif
+
+#include <memory>
+#include <memory_resource>
 #include "Util/Types/BasicArray.hpp"
+#include "Util/Types/BasicConcurrentMap.hpp"
 #include "Util/Types/BasicMap.hpp"
+#include "Util/Types/BasicSnapshotArray.hpp"
+#include "Util/Types/BasicName.hpp"
 #include "Util/Types/BasicString.hpp"
 #include "Util/Types/BasicTuple.hpp"
 
 namespace Invasion::Util
 {
+	template <typename T, typename Allocator = std::allocator<T>>
+	using MutableArray = Types::BasicArray<T, std::vector<T, Allocator>>;
+
+	template <typename T, typename Allocator = std::allocator<T>>
+	using LocalArray = Types::BasicArray<T, std::vector<T, Allocator>, Types::NoLock>;
+
+	template <typename T>
+	using PmrArray = LocalArray<T, std::pmr::polymorphic_allocator<T>>;
+
 	template <typename T>
-	using MutableArray = Types::BasicArray<T, std::vector<T>>;
+	using SpinArray = Types::BasicArray<T, std::vector<T>, Types::SpinLock>;
+
+	template <typename T, size_t N>
+	using SmallArray = Types::BasicArray<T, Types::SmallVector<T, N>, Types::NoLock>;
 
 	template <typename T, size_t N>
 	using ImmutableArray = Types::BasicArray<T, std::array<T, N>>;
 
-	using NarrowString = Types::BasicString<char>;
-	using WideString = Types::BasicString<wchar_t>;
+	template <typename T, size_t N>
+	using LocalImmutableArray = Types::BasicArray<T, std::array<T, N>, Types::NoLock>;
+
+	template <typename T>
+	using SnapshotArray = Types::BasicSnapshotArray<T>;
+
+	using NarrowString = Types::BasicString<char, Types::NoLock>;
+	using WideString = Types::BasicString<wchar_t, Types::NoLock>;
+
+	using SynchronizedNarrowString = Types::BasicString<char>;
+	using SynchronizedWideString = Types::BasicString<wchar_t>;
+
+	using PmrNarrowString = Types::BasicString<char, Types::NoLock, std::pmr::polymorphic_allocator<char>>;
+	using PmrWideString = Types::BasicString<wchar_t, Types::NoLock, std::pmr::polymorphic_allocator<wchar_t>>;
+
+	using Name = Types::BasicName<char>;
 
 	template <typename Key, typename Value>
 	using OrderedMap = Types::BasicMap<Key, Value, std::map>;
@@ -23,6 +57,15 @@ namespace Invasion::Util
 	template <typename Key, typename Value>
 	using UnorderedMap = Types::BasicMap<Key, Value, std::unordered_map>;
 
+	template <typename Key, typename Value>
+	using PmrUnorderedMap = Types::BasicMap<Key, Value, Types::PmrUnorderedMap>;
+
+	template <typename Key, typename Value>
+	using FlatMap = Types::BasicMap<Key, Value, Types::FlatHashMap>;
+
+	template <typename Key, typename Value>
+	using ConcurrentMap = Types::BasicConcurrentMap<Key, Value>;
+
 	template <typename... Arguments>
 	using Tuple = Types::BasicTuple<Arguments...>;
 
@@ -35,6 +78,8 @@ namespace Invasion::Util
 	template <typename T>
 	using Weak = std::weak_ptr<T>;
 
+#ifdef _WIN32
 	template <typename T>
 	using ComPtr = Microsoft::WRL::ComPtr<T>;
+#endif
 }
\ No newline at end of file
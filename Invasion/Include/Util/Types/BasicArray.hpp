@@ -1,15 +1,22 @@
 #pragma once
 
 #include <vector>
+#include <memory_resource>
 #include <array>
 #include <mutex>
 #include <shared_mutex>
 #include <algorithm>
+#if __has_include(<format>)
+#include <format>
+#endif
 #include <stdexcept>
 #include <initializer_list>
 #include <functional>
 #include <type_traits>
 #include "Util/AtomicIterator.hpp"
+#include "Util/Types/LockPolicy.hpp"
+#include "Util/Types/LockedView.hpp"
+#include "Util/Types/SmallVector.hpp"
 
 namespace Invasion::Util::Types
 {
@@ -21,6 +28,16 @@ namespace Invasion::Util::Types
             requires std::same_as<Container, std::vector<typename Container::value_type, typename Container::allocator_type>>;
     };
 
+    template <typename Container>
+    concept SmallVectorContainer = requires(Container c)
+    {
+        typename Container::value_type;
+        requires std::same_as<Container, SmallVector<typename Container::value_type, Container::InlineCapacity>>;
+    };
+
+    template <typename Container>
+    concept DynamicContainer = VectorContainer<Container> || SmallVectorContainer<Container>;
+
     template <typename Container>
     concept ArrayContainer = requires(Container c)
     {
@@ -28,21 +45,25 @@ namespace Invasion::Util::Types
         requires std::same_as<Container, std::array<typename Container::value_type, std::tuple_size<Container>::value>>;
     };
 
-    template <typename T, typename Container>
+    template <typename T, typename Container, LockPolicy Policy = SharedMutexLock>
     class BasicArray;
 
-    template <typename T, typename Alloc> requires VectorContainer<std::vector<T, Alloc>>
-    class BasicArray<T, std::vector<T, Alloc>>
+    template <typename T, typename Container, LockPolicy Policy> requires DynamicContainer<Container> && std::same_as<typename Container::value_type, T>
+    class BasicArray<T, Container, Policy>
     {
 
     public:
 
-        using ContainerType = std::vector<T, Alloc>;
+        using ContainerType = Container;
         using Iterator = typename ContainerType::iterator;
         using ConstIterator = typename ContainerType::const_iterator;
+        using LockType = Policy;
 
         explicit BasicArray(size_t size = 0) : data(size) {}
 
+        template <typename C = ContainerType>
+        explicit BasicArray(const typename C::allocator_type& allocator) : data(allocator) {}
+
         BasicArray(std::initializer_list<T> list)
         {
             std::unique_lock lock(*mutex);
@@ -241,24 +262,34 @@ namespace Invasion::Util::Types
             return data.empty();
         }
 
-        AtomicIterator<Iterator> begin() noexcept
+        typename Policy::template IteratorType<Iterator> begin() noexcept
+        {
+            return mutex.Wrap(data.begin());
+        }
+
+        typename Policy::template IteratorType<Iterator> end() noexcept
         {
-            return AtomicIterator<Iterator>(data.begin(), mutex);
+            return mutex.Wrap(data.end());
         }
 
-        AtomicIterator<Iterator> end() noexcept
+        typename Policy::template IteratorType<ConstIterator> cbegin() const noexcept
         {
-            return AtomicIterator<Iterator>(data.end(), mutex);
+            return mutex.Wrap(data.cbegin());
         }
 
-        AtomicIterator<ConstIterator> cbegin() const noexcept
+        typename Policy::template IteratorType<ConstIterator> cend() const noexcept
         {
-            return AtomicIterator<ConstIterator>(data.cbegin(), mutex);
+            return mutex.Wrap(data.cend());
         }
 
-        AtomicIterator<ConstIterator> cend() const noexcept
+        [[nodiscard]] ReadSpan<T, typename Policy::MutexType> Read() const
         {
-            return AtomicIterator<ConstIterator>(data.cend(), mutex);
+            return { *mutex, std::span<const T>(data) };
+        }
+
+        [[nodiscard]] WriteSpan<T, typename Policy::MutexType> Lock()
+        {
+            return { *mutex, std::span<T>(data) };
         }
 
         void Clear()
@@ -281,19 +312,20 @@ namespace Invasion::Util::Types
 
     private:
 
-        mutable std::shared_ptr<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
+        [[no_unique_address]] mutable Policy mutex;
         ContainerType data;
 
     };
 
-    template <typename T, std::size_t N> requires ArrayContainer<std::array<T, N>>
-    class BasicArray<T, std::array<T, N>>
+    template <typename T, std::size_t N, LockPolicy Policy> requires ArrayContainer<std::array<T, N>>
+    class BasicArray<T, std::array<T, N>, Policy>
     {
     public:
 
         using ContainerType = std::array<T, N>;
         using Iterator = typename ContainerType::iterator;
         using ConstIterator = typename ContainerType::const_iterator;
+        using LockType = Policy;
 
         BasicArray() = default;
 
@@ -393,24 +425,34 @@ namespace Invasion::Util::Types
             return data.empty();
         }
 
-        AtomicIterator<Iterator> begin() noexcept
+        typename Policy::template IteratorType<Iterator> begin() noexcept
+        {
+            return mutex.Wrap(data.begin());
+        }
+
+        typename Policy::template IteratorType<Iterator> end() noexcept
         {
-            return AtomicIterator<Iterator>(data.begin(), mutex);
+            return mutex.Wrap(data.end());
         }
 
-        AtomicIterator<Iterator> end() noexcept
+        typename Policy::template IteratorType<ConstIterator> cbegin() const noexcept
         {
-            return AtomicIterator<Iterator>(data.end(), mutex);
+            return mutex.Wrap(data.cbegin());
         }
 
-        AtomicIterator<ConstIterator> cbegin() const noexcept
+        typename Policy::template IteratorType<ConstIterator> cend() const noexcept
         {
-            return AtomicIterator<ConstIterator>(data.cbegin(), mutex);
+            return mutex.Wrap(data.cend());
         }
 
-        AtomicIterator<ConstIterator> cend() const noexcept
+        [[nodiscard]] ReadSpan<T, typename Policy::MutexType> Read() const
         {
-            return AtomicIterator<ConstIterator>(data.cend(), mutex);
+            return { *mutex, std::span<const T>(data) };
+        }
+
+        [[nodiscard]] WriteSpan<T, typename Policy::MutexType> Lock()
+        {
+            return { *mutex, std::span<T>(data) };
         }
 
         void Clear()
@@ -433,7 +475,7 @@ namespace Invasion::Util::Types
 
     private:
 
-        mutable std::shared_ptr<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
+        [[no_unique_address]] mutable Policy mutex;
 
         ContainerType data{};
     };
@@ -441,26 +483,24 @@ namespace Invasion::Util::Types
 
 namespace std
 {
-    template <typename T, typename Container>
-    struct hash<Invasion::Util::Types::BasicArray<T, Container>>
+    template <typename T, typename Container, typename Policy>
+    struct hash<Invasion::Util::Types::BasicArray<T, Container, Policy>>
     {
-        size_t operator()(const Invasion::Util::Types::BasicArray<T, Container>& array) const
+        size_t operator()(const Invasion::Util::Types::BasicArray<T, Container, Policy>& array) const
         {
             size_t result = 0;
 
-            array.ForEach([&result](const T& element)
-            {
+            for (const T& element : array.Read())
                 result ^= std::hash<T>{}(element)+0x9e3779b9 + (result << 6) + (result >> 2);
-            });
 
             return result;
         }
     };
 
-    template <typename T, typename Container>
-    struct equal_to<Invasion::Util::Types::BasicArray<T, Container>>
+    template <typename T, typename Container, typename Policy>
+    struct equal_to<Invasion::Util::Types::BasicArray<T, Container, Policy>>
     {
-        bool operator()(const Invasion::Util::Types::BasicArray<T, Container>& lhs, const Invasion::Util::Types::BasicArray<T, Container>& rhs) const
+        bool operator()(const Invasion::Util::Types::BasicArray<T, Container, Policy>& lhs, const Invasion::Util::Types::BasicArray<T, Container, Policy>& rhs) const
         {
             if (lhs.Length() != rhs.Length())
                 return false;
@@ -475,10 +515,10 @@ namespace std
         }
     };
 
-    template <typename T, typename Container>
-    struct less<Invasion::Util::Types::BasicArray<T, Container>>
+    template <typename T, typename Container, typename Policy>
+    struct less<Invasion::Util::Types::BasicArray<T, Container, Policy>>
     {
-        bool operator()(const Invasion::Util::Types::BasicArray<T, Container>& lhs, const Invasion::Util::Types::BasicArray<T, Container>& rhs) const
+        bool operator()(const Invasion::Util::Types::BasicArray<T, Container, Policy>& lhs, const Invasion::Util::Types::BasicArray<T, Container, Policy>& rhs) const
         {
             size_t min_length = std::min(lhs.Length(), rhs.Length());
 
@@ -494,11 +534,12 @@ namespace std
         }
     };
 
-    template <typename T, typename Container>
-    struct formatter<Invasion::Util::Types::BasicArray<T, Container>> : std::formatter<std::string>
+#if __has_include(<format>)
+    template <typename T, typename Container, typename Policy>
+    struct formatter<Invasion::Util::Types::BasicArray<T, Container, Policy>> : std::formatter<std::string>
     {
         template <typename FormatContext>
-        auto format(const Invasion::Util::Types::BasicArray<T, Container>& array, FormatContext& ctx)
+        auto format(const Invasion::Util::Types::BasicArray<T, Container, Policy>& array, FormatContext& ctx)
         {
             std::string result = "{";
             size_t len = array.Length();
@@ -515,4 +556,5 @@ namespace std
             return std::formatter<std::string>::format(result, ctx);
         }
     };
+#endif
 }
\ No newline at end of file
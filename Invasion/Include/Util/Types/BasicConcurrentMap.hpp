@@ -0,0 +1,213 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include "Util/Types/FlatHashMap.hpp"
+
+namespace Invasion::Util::Types
+{
+    template <typename Key, typename Value, size_t ShardCount = 32, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>> requires (std::has_single_bit(ShardCount))
+    class BasicConcurrentMap
+    {
+
+    public:
+
+        using ContainerType = FlatHashMap<Key, Value, Hash, KeyEqual>;
+
+        BasicConcurrentMap() = default;
+
+        BasicConcurrentMap(const BasicConcurrentMap&) = delete;
+        BasicConcurrentMap& operator=(const BasicConcurrentMap&) = delete;
+
+        BasicConcurrentMap& operator|=(const std::pair<Key, Value>& other)
+        {
+            Shard& shard = ShardOf(other.first);
+
+            std::unique_lock lock(shard.mutex);
+
+            shard.data.insert(other);
+
+            return *this;
+        }
+
+        BasicConcurrentMap& operator-=(const Key& other)
+        {
+            Shard& shard = ShardOf(other);
+
+            std::unique_lock lock(shard.mutex);
+
+            shard.data.erase(other);
+
+            return *this;
+        }
+
+        [[nodiscard]] Value Get(const Key& key) const
+        {
+            const Shard& shard = ShardOf(key);
+
+            std::shared_lock lock(shard.mutex);
+
+            auto iterator = shard.data.find(key);
+
+            return iterator != shard.data.end() ? iterator->second : Value();
+        }
+
+        [[nodiscard]] std::optional<Value> TryGet(const Key& key) const
+        {
+            const Shard& shard = ShardOf(key);
+
+            std::shared_lock lock(shard.mutex);
+
+            auto iterator = shard.data.find(key);
+
+            if (iterator == shard.data.end())
+                return std::nullopt;
+
+            return iterator->second;
+        }
+
+        Value GetOrInsert(const Key& key, const Value& value)
+        {
+            Shard& shard = ShardOf(key);
+
+            std::unique_lock lock(shard.mutex);
+
+            return shard.data.insert({ key, value }).first->second;
+        }
+
+        std::optional<Value> Extract(const Key& key)
+        {
+            Shard& shard = ShardOf(key);
+
+            std::unique_lock lock(shard.mutex);
+
+            auto iterator = shard.data.find(key);
+
+            if (iterator == shard.data.end())
+                return std::nullopt;
+
+            std::optional<Value> result = std::move(iterator->second);
+
+            shard.data.erase(iterator);
+
+            return result;
+        }
+
+        [[nodiscard]] bool Contains(const Key& key) const
+        {
+            const Shard& shard = ShardOf(key);
+
+            std::shared_lock lock(shard.mutex);
+
+            return shard.data.contains(key);
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return Length() == 0;
+        }
+
+        [[nodiscard]] size_t Length() const
+        {
+            size_t length = 0;
+
+            for (const Shard& shard : shards)
+            {
+                std::shared_lock lock(shard.mutex);
+
+                length += shard.data.size();
+            }
+
+            return length;
+        }
+
+        void Clear()
+        {
+            for (Shard& shard : shards)
+            {
+                std::unique_lock lock(shard.mutex);
+
+                shard.data.clear();
+            }
+        }
+
+        void ForEach(const std::function<void(const Key&, Value&)>& func)
+        {
+            for (Shard& shard : shards)
+            {
+                std::unique_lock lock(shard.mutex);
+
+                for (auto& [key, value] : shard.data)
+                    func(key, value);
+            }
+        }
+
+        void ForEach(const std::function<void(const Key&, const Value&)>& func) const
+        {
+            for (const Shard& shard : shards)
+            {
+                std::shared_lock lock(shard.mutex);
+
+                for (const auto& [key, value] : shard.data)
+                    func(key, value);
+            }
+        }
+
+        void ForEach(const std::function<void(Value&)>& func)
+        {
+            for (Shard& shard : shards)
+            {
+                std::unique_lock lock(shard.mutex);
+
+                for (auto& pair : shard.data)
+                    func(pair.second);
+            }
+        }
+
+        void ForEach(const std::function<void(const Value&)>& func) const
+        {
+            for (const Shard& shard : shards)
+            {
+                std::shared_lock lock(shard.mutex);
+
+                for (const auto& pair : shard.data)
+                    func(pair.second);
+            }
+        }
+
+    private:
+
+        struct alignas(64) Shard
+        {
+            mutable std::shared_mutex mutex;
+            ContainerType data;
+        };
+
+        Shard& ShardOf(const Key& key)
+        {
+            return shards[IndexOf(key)];
+        }
+
+        const Shard& ShardOf(const Key& key) const
+        {
+            return shards[IndexOf(key)];
+        }
+
+        size_t IndexOf(const Key& key) const
+        {
+            uint64_t value = static_cast<uint64_t>(hash(key)) * 0xC2B2AE3D27D4EB4Full;
+
+            return static_cast<size_t>(value >> 40) & (ShardCount - 1);
+        }
+
+        std::array<Shard, ShardCount> shards;
+
+        [[no_unique_address]] Hash hash;
+
+    };
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <unordered_map>
+#include <memory_resource>
 #include <shared_mutex>
 #include <memory>
 #include <initializer_list>
@@ -12,6 +13,8 @@
 #include <ranges>
 #include <type_traits>
 #include "Util/AtomicIterator.hpp"
+#include "Util/Types/FlatHashMap.hpp"
+#include "Util/Types/LockedView.hpp"
 
 namespace Invasion::Util::Types
 {
@@ -27,10 +30,15 @@ namespace Invasion::Util::Types
         { c.empty() } -> std::convertible_to<bool>;
     };
 
+    template <typename Key, typename Value>
+    using PmrUnorderedMap = std::pmr::unordered_map<Key, Value>;
+
     template <template <typename, typename> class Container, typename Key, typename Value>
     concept SupportedMapContainer =
         std::is_same_v<Container<Key, Value>, std::map<Key, Value>> ||
-        std::is_same_v<Container<Key, Value>, std::unordered_map<Key, Value>>;
+        std::is_same_v<Container<Key, Value>, std::unordered_map<Key, Value>> ||
+        std::is_same_v<Container<Key, Value>, std::pmr::unordered_map<Key, Value>> ||
+        std::is_same_v<Container<Key, Value>, FlatHashMap<Key, Value>>;
 
     template <typename Key, typename Value, template <typename, typename> class Container = std::map> requires SupportedMapContainer<Container, Key, Value>
     class BasicMap
@@ -42,6 +50,9 @@ namespace Invasion::Util::Types
 
         BasicMap() = default;
 
+        template <typename C = ContainerType>
+        explicit BasicMap(const typename C::allocator_type& allocator) : data(allocator) { }
+
         BasicMap(std::initializer_list<std::pair<Key, Value>> list)
         {
             std::unique_lock lock(*mutex);
@@ -374,7 +385,7 @@ namespace Invasion::Util::Types
             return data.find(key) != data.end();
         }
 
-        template <typename C = ContainerType> requires (std::is_same_v<C, std::map<Key, Value>> || std::is_same_v<C, std::unordered_map<Key, Value>>)
+        template <typename C = ContainerType> requires (std::is_same_v<C, std::map<Key, Value>> || std::is_same_v<C, std::unordered_map<Key, Value>> || std::is_same_v<C, std::pmr::unordered_map<Key, Value>> || std::is_same_v<C, FlatHashMap<Key, Value>>)
         bool Contains(const Value& value) const 
         {
             std::shared_lock lock(*mutex);
@@ -463,6 +474,16 @@ namespace Invasion::Util::Types
             });
         }
 
+        [[nodiscard]] ReadRange<ContainerType, std::shared_mutex> Read() const
+        {
+            return { *mutex, std::ranges::ref_view<const ContainerType>(data) };
+        }
+
+        [[nodiscard]] WriteRange<ContainerType, std::shared_mutex> Lock()
+        {
+            return { *mutex, std::ranges::ref_view<ContainerType>(data) };
+        }
+
         [[nodiscard]] AtomicIterator<typename ContainerType::iterator> begin() noexcept 
         {
             std::shared_lock lock(*mutex);
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#if __has_include(<format>)
+#include <format>
+#endif
+#include "Util/Types/BasicString.hpp"
+
+namespace Invasion::Util::Types
+{
+    template <CharType T>
+    struct BasicNameEntry
+    {
+        size_t hash;
+        std::basic_string<T> value;
+    };
+
+    template <CharType T>
+    class BasicNameTable
+    {
+
+    public:
+
+        using ViewType = std::basic_string_view<T>;
+        using EntryType = BasicNameEntry<T>;
+
+        BasicNameTable(const BasicNameTable&) = delete;
+        BasicNameTable& operator=(const BasicNameTable&) = delete;
+
+        const EntryType* Intern(ViewType value)
+        {
+            if (value.empty())
+                return nullptr;
+
+            size_t hash = std::hash<ViewType>()(value);
+            Shard& shard = ShardOf(hash);
+
+            if (const EntryType* existing = Find(shard, hash, value))
+                return existing;
+
+            std::unique_lock lock(shard.mutex);
+
+            auto iterator = shard.entries.find(Key{ hash, value });
+
+            if (iterator != shard.entries.end())
+                return iterator->second.get();
+
+            auto entry = std::make_unique<EntryType>(EntryType{ hash, std::basic_string<T>(value) });
+            const EntryType* result = entry.get();
+
+            shard.entries.emplace(Key{ hash, result->value }, std::move(entry));
+
+            return result;
+        }
+
+        [[nodiscard]] const EntryType* Find(ViewType value) const
+        {
+            if (value.empty())
+                return nullptr;
+
+            size_t hash = std::hash<ViewType>()(value);
+
+            return Find(ShardOf(hash), hash, value);
+        }
+
+        [[nodiscard]] size_t Count() const
+        {
+            size_t count = 0;
+
+            for (const Shard& shard : shards)
+            {
+                std::shared_lock lock(shard.mutex);
+                count += shard.entries.size();
+            }
+
+            return count;
+        }
+
+        static BasicNameTable& GetInstance()
+        {
+            std::call_once(initFlag, []()
+            {
+                instance.reset(new BasicNameTable);
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        BasicNameTable() = default;
+
+        struct Key
+        {
+            size_t hash;
+            ViewType value;
+
+            bool operator==(const Key& other) const noexcept
+            {
+                return hash == other.hash && value == other.value;
+            }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const noexcept
+            {
+                return key.hash;
+            }
+        };
+
+        struct alignas(64) Shard
+        {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<Key, std::unique_ptr<EntryType>, KeyHash> entries;
+        };
+
+        static constexpr size_t ShardCount = 16;
+
+        Shard& ShardOf(size_t hash)
+        {
+            return shards[IndexOf(hash)];
+        }
+
+        const Shard& ShardOf(size_t hash) const
+        {
+            return shards[IndexOf(hash)];
+        }
+
+        static size_t IndexOf(size_t hash)
+        {
+            uint64_t value = static_cast<uint64_t>(hash) * 0xC2B2AE3D27D4EB4Full;
+
+            return static_cast<size_t>(value >> 40) & (ShardCount - 1);
+        }
+
+        static const EntryType* Find(const Shard& shard, size_t hash, ViewType value)
+        {
+            std::shared_lock lock(shard.mutex);
+
+            auto iterator = shard.entries.find(Key{ hash, value });
+
+            return iterator != shard.entries.end() ? iterator->second.get() : nullptr;
+        }
+
+        std::array<Shard, ShardCount> shards;
+
+        static std::unique_ptr<BasicNameTable> instance;
+        static std::once_flag initFlag;
+    };
+
+    template <CharType T>
+    std::unique_ptr<BasicNameTable<T>> BasicNameTable<T>::instance;
+
+    template <CharType T>
+    std::once_flag BasicNameTable<T>::initFlag;
+
+    template <CharType T>
+    class BasicName
+    {
+
+    public:
+
+        using ViewType = std::basic_string_view<T>;
+
+        constexpr BasicName() noexcept = default;
+
+        BasicName(ViewType value) : entry(BasicNameTable<T>::GetInstance().Intern(value)) { }
+
+        BasicName(const T* value) : BasicName(ViewType(value)) { }
+
+        BasicName(const std::basic_string<T>& value) : BasicName(ViewType(value)) { }
+
+        template <LockPolicy Lock, typename Allocator>
+        BasicName(const BasicString<T, Lock, Allocator>& value)
+        {
+            if constexpr (Lock::IsSynchronized)
+                entry = BasicNameTable<T>::GetInstance().Intern(static_cast<std::basic_string<T>>(value));
+            else
+                entry = BasicNameTable<T>::GetInstance().Intern(value.View());
+        }
+
+        [[nodiscard]] static BasicName Find(ViewType value)
+        {
+            BasicName result;
+
+            result.entry = BasicNameTable<T>::GetInstance().Find(value);
+
+            return result;
+        }
+
+        template <LockPolicy Lock, typename Allocator>
+        [[nodiscard]] static BasicName Find(const BasicString<T, Lock, Allocator>& value)
+        {
+            if constexpr (Lock::IsSynchronized)
+                return Find(static_cast<std::basic_string<T>>(value));
+            else
+                return Find(value.View());
+        }
+
+        [[nodiscard]] constexpr bool operator==(const BasicName& other) const noexcept
+        {
+            return entry == other.entry;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const BasicName& other) const noexcept
+        {
+            return entry != other.entry;
+        }
+
+        [[nodiscard]] bool operator<(const BasicName& other) const noexcept
+        {
+            return GetView() < other.GetView();
+        }
+
+        [[nodiscard]] size_t GetHash() const noexcept
+        {
+            return entry ? entry->hash : 0;
+        }
+
+        [[nodiscard]] ViewType GetView() const noexcept
+        {
+            return entry ? ViewType(entry->value) : ViewType();
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept
+        {
+            return entry == nullptr;
+        }
+
+        template <LockPolicy Lock>
+        operator BasicString<T, Lock>() const
+        {
+            return BasicString<T, Lock>(GetView());
+        }
+
+    private:
+
+        const BasicNameEntry<T>* entry = nullptr;
+
+    };
+
+    template <CharType T>
+    std::basic_ostream<T>& operator<<(std::basic_ostream<T>& stream, const BasicName<T>& name)
+    {
+        stream << name.GetView();
+
+        return stream;
+    }
+}
+
+namespace std
+{
+    template <typename T>
+    struct hash<Invasion::Util::Types::BasicName<T>>
+    {
+        size_t operator()(const Invasion::Util::Types::BasicName<T>& name) const noexcept
+        {
+            return name.GetHash();
+        }
+    };
+
+#if __has_include(<format>)
+    template <typename T, typename Char>
+    struct formatter<Invasion::Util::Types::BasicName<T>, Char> : formatter<std::basic_string_view<T>, Char>
+    {
+        template <typename FormatContext>
+        auto format(const Invasion::Util::Types::BasicName<T>& name, FormatContext& ctx) const
+        {
+            return formatter<std::basic_string_view<T>, Char>::format(name.GetView(), ctx);
+        }
+    };
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Invasion::Util::Types
+{
+    // Readers never take writerMutex and never wait on a writer's copy, but they are not lock-free:
+    // std::atomic<std::shared_ptr> is implemented with an internal lock on libstdc++ and MSVC, so
+    // Snapshot() can briefly contend with a concurrent Publish or another reader's refcount update.
+    template <typename T>
+    class BasicSnapshotArray
+    {
+
+    public:
+
+        using ContainerType = std::vector<T>;
+        using SnapshotType = std::shared_ptr<const ContainerType>;
+
+        BasicSnapshotArray() : snapshot(std::make_shared<const ContainerType>()) { }
+
+        BasicSnapshotArray(const BasicSnapshotArray&) = delete;
+        BasicSnapshotArray& operator=(const BasicSnapshotArray&) = delete;
+
+        [[nodiscard]] SnapshotType Snapshot() const noexcept
+        {
+            return snapshot.load(std::memory_order_acquire);
+        }
+
+        BasicSnapshotArray& operator+=(const T& value)
+        {
+            std::unique_lock lock(writerMutex);
+
+            auto next = std::make_shared<ContainerType>(*snapshot.load(std::memory_order_relaxed));
+
+            next->push_back(value);
+
+            Publish(std::move(next));
+
+            return *this;
+        }
+
+        BasicSnapshotArray& operator-=(const T& value)
+        {
+            std::unique_lock lock(writerMutex);
+
+            SnapshotType current = snapshot.load(std::memory_order_relaxed);
+
+            auto iterator = std::ranges::find(*current, value);
+
+            if (iterator == current->end())
+                return *this;
+
+            auto next = std::make_shared<ContainerType>(*current);
+
+            next->erase(next->begin() + (iterator - current->begin()));
+
+            Publish(std::move(next));
+
+            return *this;
+        }
+
+        void Replace(const T& oldValue, const T& newValue)
+        {
+            std::unique_lock lock(writerMutex);
+
+            auto next = std::make_shared<ContainerType>(*snapshot.load(std::memory_order_relaxed));
+
+            auto iterator = std::ranges::find(*next, oldValue);
+
+            if (iterator != next->end())
+                *iterator = newValue;
+            else
+                next->push_back(newValue);
+
+            Publish(std::move(next));
+        }
+
+        SnapshotType Exchange(ContainerType values = {})
+        {
+            std::unique_lock lock(writerMutex);
+
+            return snapshot.exchange(std::make_shared<const ContainerType>(std::move(values)), std::memory_order_acq_rel);
+        }
+
+        void Clear()
+        {
+            Exchange();
+        }
+
+        [[nodiscard]] size_t Length() const noexcept
+        {
+            return Snapshot()->size();
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept
+        {
+            return Snapshot()->empty();
+        }
+
+    private:
+
+        void Publish(std::shared_ptr<ContainerType>&& next)
+        {
+            snapshot.store(std::move(next), std::memory_order_release);
+        }
+
+        std::atomic<SnapshotType> snapshot;
+        std::mutex writerMutex;
+
+    };
+}
\ No newline at end of file
@@ -3,13 +3,21 @@
 #include <mutex>
 #include <shared_mutex>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <iostream>
 #include <type_traits>
 #include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <typeinfo>
+#if __has_include(<format>)
 #include <format>
+#endif
 #include "Util/AtomicIterator.hpp"
+#include "Util/Types/LockPolicy.hpp"
 
 namespace Invasion::Util::Types
 {
@@ -22,54 +30,73 @@ namespace Invasion::Util::Types
     template <typename From, typename To>
     concept ConvertibleCharTypes = CharType<From> && CharType<To>;
 
-    template <CharType T>
-    class BasicString 
+    template <CharType T, LockPolicy Lock = SharedMutexLock, typename Allocator = std::allocator<T>>
+    class BasicString
     {
 
     public:
 
+        using StringType = std::basic_string<T, std::char_traits<T>, Allocator>;
+        using ViewType = std::basic_string_view<T>;
+        using LockType = Lock;
+        using AllocatorType = Allocator;
+
         BasicString() = default;
 
+        explicit BasicString(const Allocator& allocator) : data(allocator) { }
+
+        BasicString(ViewType str, const Allocator& allocator) : data(str, allocator) { }
+
         ~BasicString() = default;
 
-        BasicString(const BasicString& other) noexcept 
+        BasicString(const BasicString& other)
         {
             std::shared_lock lock(*other.mutex);
             data = other.data;
-            mutex = std::make_shared<std::shared_mutex>();
         }
 
-        BasicString(BasicString&& other) noexcept 
+        BasicString(BasicString&& other) noexcept
         {
             std::unique_lock lock(*other.mutex);
             data = std::move(other.data);
-            mutex = std::make_shared<std::shared_mutex>();
         }
 
+        template <typename U, LockPolicy L, typename A> requires (ConvertibleCharTypes<U, T> && !std::is_same_v<BasicString<U, L, A>, BasicString>)
+        BasicString(const BasicString<U, L, A>& other)
+        {
+            auto otherData = Snapshot(other);
+            Assign(Convert<U, T>(otherData));
+        }
+
+        BasicString(StringType&& str) noexcept : data(std::move(str)) { }
+
         template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString(const std::basic_string<U>& str) noexcept 
+        BasicString(const std::basic_string<U>& str)
         {
-            data = Convert<U, T>(str);
-            mutex = std::make_shared<std::shared_mutex>();
+            Assign(Convert<U, T>(str));
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString(const U* str) noexcept 
+        explicit BasicString(std::basic_string_view<U> str)
         {
-            data = Convert<U, T>(std::basic_string<U>(str));
-            mutex = std::make_shared<std::shared_mutex>();
+            Assign(Convert<U, T>(str));
+        }
+
+        template <typename U> requires ConvertibleCharTypes<U, T>
+        BasicString(const U* str)
+        {
+            Assign(Convert<U, T>(std::basic_string_view<U>(str)));
         }
 
 		template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString(const U& other) noexcept
+        BasicString(const U& other)
         {
-			data = Convert<U, T>(std::basic_string<U>(1, other));
-			mutex = std::make_shared<std::shared_mutex>();
+			Assign(Convert<U, T>(std::basic_string_view<U>(&other, 1)));
         }
 
-        BasicString& operator=(BasicString&& other) noexcept 
+        BasicString& operator=(BasicString&& other) noexcept
         {
-            if (this != &other) 
+            if (this != &other)
             {
                 std::scoped_lock lock(*mutex, *other.mutex);
                 data = std::move(other.data);
@@ -78,12 +105,15 @@ namespace Invasion::Util::Types
             return *this;
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString& operator=(const BasicString<U>& input)
+        template <typename U, LockPolicy L, typename A> requires (ConvertibleCharTypes<U, T> && !std::is_same_v<BasicString<U, L, A>, BasicString>)
+        BasicString& operator=(const BasicString<U, L, A>& input)
         {
+            auto inputData = Snapshot(input);
+            auto converted = Convert<U, T>(inputData);
+
             std::unique_lock lock(*mutex);
 
-            data = Convert<U, T>(input);
+            Assign(std::move(converted));
 
             return *this;
         }
@@ -91,207 +121,200 @@ namespace Invasion::Util::Types
         template <typename U> requires ConvertibleCharTypes<U, T>
         BasicString& operator=(const std::basic_string<U>& input)
         {
+            auto converted = Convert<U, T>(input);
+
             std::unique_lock lock(*mutex);
 
-            data = Convert<U, T>(input);
+            Assign(std::move(converted));
 
             return *this;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString& operator=(const U* str) 
+        BasicString& operator=(const U* str)
         {
+            auto converted = Convert<U, T>(std::basic_string_view<U>(str));
+
             std::unique_lock lock(*mutex);
 
-            data = Convert<U, T>(std::basic_string<U>(str));
+            Assign(std::move(converted));
 
             return *this;
         }
 
-        BasicString& operator=(const BasicString& other) noexcept 
+        BasicString& operator=(const BasicString& other)
         {
-            if (this != &other) 
+            if (this != &other)
             {
-                std::scoped_lock lock(*mutex, *other.mutex);
+                std::unique_lock lock(*mutex, std::defer_lock);
+                std::shared_lock lockOther(*other.mutex, std::defer_lock);
+                std::lock(lock, lockOther);
+
                 data = other.data;
             }
 
             return *this;
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator==(const BasicString<U>& other) const
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        bool operator==(const BasicString<U, L, A>& other) const
         {
-            std::shared_lock lock(*mutex);
+            if (IsSameObject(other))
+                return true;
 
-            return data == Convert<U, T>(other);
+            auto otherData = Snapshot(other);
+
+            return Compare(ConvertView<U>(otherData)) == 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator==(const std::basic_string<U>& other) const 
+        bool operator==(const std::basic_string<U>& other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data == Convert<U, T>(other);
+            return Compare(ConvertView<U>(other)) == 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator==(const U* other) const 
+        bool operator==(const U* other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data == Convert<U, T>(std::basic_string<U>(other));
+            return Compare(ConvertView<U>(other)) == 0;
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator!=(const BasicString<U>& other) const 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        bool operator!=(const BasicString<U, L, A>& other) const
         {
             return !(*this == other);
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator!=(const std::basic_string<U>& other) const 
+        bool operator!=(const std::basic_string<U>& other) const
         {
             return !(*this == other);
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator!=(const U* other) const 
+        bool operator!=(const U* other) const
         {
             return !(*this == other);
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator<(const BasicString<U>& other) const 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        bool operator<(const BasicString<U, L, A>& other) const
         {
-            std::shared_lock lock(*mutex);
+            if (IsSameObject(other))
+                return false;
 
-            return data < Convert<U, T>(other);
+            auto otherData = Snapshot(other);
+
+            return Compare(ConvertView<U>(otherData)) < 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator<(const std::basic_string<U>& other) const 
+        bool operator<(const std::basic_string<U>& other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data < Convert<U, T>(other);
+            return Compare(ConvertView<U>(other)) < 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator<(const U* other) const 
+        bool operator<(const U* other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data < Convert<U, T>(std::basic_string<U>(other));
+            return Compare(ConvertView<U>(other)) < 0;
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator<=(const BasicString<U>& other) const
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        bool operator<=(const BasicString<U, L, A>& other) const
         {
-            std::shared_lock lock(*mutex);
+            if (IsSameObject(other))
+                return true;
+
+            auto otherData = Snapshot(other);
 
-            return data <= Convert<U, T>(other);
+            return Compare(ConvertView<U>(otherData)) <= 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
         bool operator<=(const std::basic_string<U>& other) const
         {
-            std::shared_lock lock(*mutex);
-            return data <= Convert<U, T>(other);
+            return Compare(ConvertView<U>(other)) <= 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator<=(const U* other) const 
+        bool operator<=(const U* other) const
         {
-            std::shared_lock lock(*mutex);
-            return data <= Convert<U, T>(std::basic_string<U>(other));
+            return Compare(ConvertView<U>(other)) <= 0;
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator>(const BasicString<U>& other) const 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        bool operator>(const BasicString<U, L, A>& other) const
         {
-            std::shared_lock lock(*mutex);
-            return data > Convert<U, T>(other);
+            if (IsSameObject(other))
+                return false;
+
+            auto otherData = Snapshot(other);
+
+            return Compare(ConvertView<U>(otherData)) > 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
         bool operator>(const std::basic_string<U>& other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data > Convert<U, T>(other);
+            return Compare(ConvertView<U>(other)) > 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator>(const U* other) const 
+        bool operator>(const U* other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data > Convert<U, T>(std::basic_string<U>(other));
+            return Compare(ConvertView<U>(other)) > 0;
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator>=(const BasicString<U>& other) const 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        bool operator>=(const BasicString<U, L, A>& other) const
         {
-            std::shared_lock lock(*mutex);
+            if (IsSameObject(other))
+                return true;
 
-            return data >= Convert<U, T>(other);
+            auto otherData = Snapshot(other);
+
+            return Compare(ConvertView<U>(otherData)) >= 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator>=(const std::basic_string<U>& other) const 
+        bool operator>=(const std::basic_string<U>& other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data >= Convert<U, T>(other);
+            return Compare(ConvertView<U>(other)) >= 0;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        bool operator>=(const U* other) const 
+        bool operator>=(const U* other) const
         {
-            std::shared_lock lock(*mutex);
-
-            return data >= Convert<U, T>(std::basic_string<U>(other));
+            return Compare(ConvertView<U>(other)) >= 0;
         }
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        [[nodiscard]] BasicString operator+(const BasicString<U>& other) const 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        [[nodiscard]] BasicString operator+(const BasicString<U, L, A>& other) const
         {
-            BasicString<T> otherConverted(other);
-
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
+            BasicString result = *this;
 
-            BasicString<T> result;
-
-            result.data = this->data + otherConverted.data;
+            result += other;
 
             return result;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        [[nodiscard]] BasicString operator+(const std::basic_string<U>& other) const 
+        [[nodiscard]] BasicString operator+(const std::basic_string<U>& other) const
         {
-            BasicString<T> otherConverted(other);
-
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-
-            BasicString<T> result;
+            BasicString result = *this;
 
-            result.data = this->data + otherConverted.data;
+            result += other;
 
             return result;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        [[nodiscard]] BasicString operator+(const U* other) const 
+        [[nodiscard]] BasicString operator+(const U* other) const
         {
-            BasicString<T> otherConverted(other);
+            BasicString result = *this;
 
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-
-            BasicString<T> result;
-
-            result.data = this->data + otherConverted.data;
+            result += other;
 
             return result;
         }
@@ -299,108 +322,74 @@ namespace Invasion::Util::Types
         template <typename U> requires ConvertibleCharTypes<U, T>
 		[[nodiscard]] BasicString operator+(const U& other) const
 		{
-			BasicString<T> otherConverted(other);
-
-			std::scoped_lock lock(*mutex, *otherConverted.mutex);
+			BasicString result = *this;
 
-			BasicString<T> result;
-
-			result.data = this->data + otherConverted.data;
+			result += other;
 
 			return result;
 		}
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString& operator+=(const BasicString<U>& other) 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        BasicString& operator+=(const BasicString<U, L, A>& other)
         {
-            BasicString<T> otherConverted(other);
-
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            this->data += otherConverted.data;
+            auto otherData = Snapshot(other);
 
-            return *this;
+            return Append(ConvertView<U>(otherData));
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString& operator+=(const std::basic_string<U>& other) 
+        BasicString& operator+=(const std::basic_string<U>& other)
         {
-            BasicString<T> otherConverted(other);
-
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            this->data += otherConverted.data;
-
-            return *this;
+            return Append(ConvertView<U>(other));
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString& operator+=(const U* other) 
+        BasicString& operator+=(const U* other)
         {
-            BasicString<T> otherConverted(other);
-
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            this->data += otherConverted.data;
-
-            return *this;
+            return Append(ConvertView<U>(other));
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
 		BasicString& operator+=(const U& other)
 		{
-			BasicString<T> otherConverted(other);
+            if constexpr (std::is_same_v<U, T>)
+            {
+                std::unique_lock lock(*mutex);
 
-			std::scoped_lock lock(*mutex, *otherConverted.mutex);
-			this->data += otherConverted.data;
+                data.push_back(other);
 
-			return *this;
+                return *this;
+            }
+            else
+                return Append(ConvertView<U>(std::basic_string_view<U>(&other, 1)));
 		}
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        [[nodiscard]] BasicString operator-(const BasicString<U>& other) const 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        [[nodiscard]] BasicString operator-(const BasicString<U, L, A>& other) const
         {
-            BasicString<T> otherConverted(other);
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            BasicString<T> result = *this;
-            size_t pos = result.data.find(otherConverted.data);
+            BasicString result = *this;
 
-            while (pos != std::basic_string<T>::npos) 
-            {
-                result.data.erase(pos, otherConverted.data.length());
-                pos = result.data.find(otherConverted.data, pos);
-            }
+            result -= other;
 
             return result;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        [[nodiscard]] BasicString operator-(const std::basic_string<U>& other) const 
+        [[nodiscard]] BasicString operator-(const std::basic_string<U>& other) const
         {
-            BasicString<T> otherConverted(other);
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            BasicString<T> result = *this;
-            size_t pos = result.data.find(otherConverted.data);
+            BasicString result = *this;
 
-            while (pos != std::basic_string<T>::npos) 
-            {
-                result.data.erase(pos, otherConverted.data.length());
-                pos = result.data.find(otherConverted.data, pos);
-            }
+            result -= other;
 
             return result;
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        [[nodiscard]] BasicString operator-(const U* other) const 
+        [[nodiscard]] BasicString operator-(const U* other) const
         {
-            BasicString<T> otherConverted(other);
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            BasicString<T> result = *this;
-            size_t pos = result.data.find(otherConverted.data);
+            BasicString result = *this;
 
-            while (pos != std::basic_string<T>::npos) 
-            {
-                result.data.erase(pos, otherConverted.data.length());
-                pos = result.data.find(otherConverted.data, pos);
-            }
+            result -= other;
 
             return result;
         }
@@ -408,261 +397,183 @@ namespace Invasion::Util::Types
 		template <typename U> requires ConvertibleCharTypes<U, T>
 		[[nodiscard]] BasicString operator-(const U& other) const
 		{
-			BasicString<T> otherConverted(other);
-			std::scoped_lock lock(*mutex, *otherConverted.mutex);
-			BasicString<T> result = *this;
-			size_t pos = result.data.find(otherConverted.data);
+			BasicString result = *this;
 
-			while (pos != std::basic_string<T>::npos)
-			{
-				result.data.erase(pos, otherConverted.data.length());
-				pos = result.data.find(otherConverted.data, pos);
-			}
+			result -= other;
 
 			return result;
 		}
 
-        template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString& operator-=(const BasicString<U>& other) 
+        template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+        BasicString& operator-=(const BasicString<U, L, A>& other)
         {
-            BasicString<T> otherConverted(other);
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            size_t pos = data.find(otherConverted.data);
+            StringType otherConverted = Convert<U, T>(Snapshot(other));
 
-            while (pos != std::basic_string<T>::npos) 
-            {
-                data.erase(pos, otherConverted.data.length());
-                pos = data.find(otherConverted.data, pos);
-            }
-
-            return *this;
+            return Remove(otherConverted);
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-        BasicString& operator-=(const std::basic_string<U>& other) 
+        BasicString& operator-=(const std::basic_string<U>& other)
         {
-            BasicString<T> otherConverted(other);
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            size_t pos = data.find(otherConverted.data);
-
-            while (pos != std::basic_string<T>::npos) 
-            {
-                data.erase(pos, otherConverted.data.length());
-                pos = data.find(otherConverted.data, pos);
-            }
-
-            return *this;
+            return Remove(ConvertView<U>(other));
         }
 
         template <typename U> requires ConvertibleCharTypes<U, T>
         BasicString& operator-=(const U* other)
         {
-            BasicString<T> otherConverted(other);
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-            size_t pos = data.find(otherConverted.data);
-
-            while (pos != std::basic_string<T>::npos)
-            {
-                data.erase(pos, otherConverted.data.length());
-                pos = data.find(otherConverted.data, pos);
-            }
-
-            return *this;
+            return Remove(ConvertView<U>(other));
         }
 
 		template <typename U> requires ConvertibleCharTypes<U, T>
 		BasicString& operator-=(const U& other)
 		{
-			BasicString<T> otherConverted(other);
-			std::scoped_lock lock(*mutex, *otherConverted.mutex);
-
-			size_t pos = data.find(otherConverted.data);
-
-			while (pos != std::basic_string<T>::npos)
-			{
-				data.erase(pos, otherConverted.data.length());
-				pos = data.find(otherConverted.data, pos);
-			}
-
-			return *this;
+			return Remove(ConvertView<U>(std::basic_string_view<U>(&other, 1)));
 		}
 
-        T& operator[](size_t index) 
+        T& operator[](size_t index) requires (!Lock::IsSynchronized)
         {
-            std::shared_lock lock(*mutex);
-
             return data[index];
         }
 
-        const T& operator[](size_t index) const 
+        const T& operator[](size_t index) const requires (!Lock::IsSynchronized)
+        {
+            return data.at(index);
+        }
+
+        T operator[](size_t index) const requires (Lock::IsSynchronized)
         {
             std::shared_lock lock(*mutex);
 
             return data.at(index);
         }
 
-        template <typename F, typename L> requires ConvertibleCharTypes<F, T> && ConvertibleCharTypes<L, T>
-        void FindAndReplace(const BasicString<F>& find, const BasicString<L>& replace) 
+        template <typename F, LockPolicy FL, typename FA, typename L, LockPolicy LL, typename LA> requires ConvertibleCharTypes<F, T> && ConvertibleCharTypes<L, T>
+        void FindAndReplace(const BasicString<F, FL, FA>& find, const BasicString<L, LL, LA>& replace)
         {
-            BasicString<T> findConverted(find);
-            BasicString<T> replaceConverted(replace);
-            std::scoped_lock lock(*mutex, *findConverted.mutex, *replaceConverted.mutex);
-            size_t pos = 0;
+            StringType findConverted = Convert<F, T>(Snapshot(find));
+            StringType replaceConverted = Convert<L, T>(Snapshot(replace));
 
-            while ((pos = data.find(findConverted.data, pos)) != std::basic_string<T>::npos) 
-            {
-                data.replace(pos, findConverted.data.length(), replaceConverted.data);
-                pos += replaceConverted.data.length();
-            }
+            Replace(findConverted, replaceConverted);
         }
 
         template <typename F, typename L> requires ConvertibleCharTypes<F, T> && ConvertibleCharTypes<L, T>
-        void FindAndReplace(const std::basic_string<F>& find, const std::basic_string<L>& replace) 
+        void FindAndReplace(const std::basic_string<F>& find, const std::basic_string<L>& replace)
         {
-            BasicString<T> findConverted(find);
-            BasicString<T> replaceConverted(replace);
-            std::scoped_lock lock(*mutex, *findConverted.mutex, *replaceConverted.mutex);
-            size_t pos = 0;
-
-            while ((pos = data.find(findConverted.data, pos)) != std::basic_string<T>::npos) 
-            {
-                data.replace(pos, findConverted.data.length(), replaceConverted.data);
-
-                pos += replaceConverted.data.length();
-            }
+            Replace(ConvertView<F>(find), ConvertView<L>(replace));
         }
 
         template <typename F, typename L> requires ConvertibleCharTypes<F, T> && ConvertibleCharTypes<L, T>
-        void FindAndReplace(const F* find, const L* replace) 
+        void FindAndReplace(const F* find, const L* replace)
         {
-            BasicString<T> findConverted(find);
-            BasicString<T> replaceConverted(replace);
-            std::scoped_lock lock(*mutex, *findConverted.mutex, *replaceConverted.mutex);
-
-            size_t pos = 0;
-
-            while ((pos = data.find(findConverted.data, pos)) != std::basic_string<T>::npos) 
-            {
-                data.replace(pos, findConverted.data.length(), replaceConverted.data);
-                pos += replaceConverted.data.length();
-            }
+            Replace(ConvertView<F>(find), ConvertView<L>(replace));
         }
 
-        void ToUpper() 
+        void ToUpper()
         {
             std::unique_lock lock(*mutex);
-            std::ranges::transform(data, data.begin(), [](T ch) -> T 
+            std::ranges::transform(data, data.begin(), [](T ch) -> T
             {
-                if constexpr (std::is_same_v<T, char>) 
+                if constexpr (std::is_same_v<T, char>)
                     return static_cast<T>(std::toupper(static_cast<unsigned char>(ch)));
-                else 
+                else
                     return static_cast<T>(std::toupper(ch));
             });
         }
 
-        void ToLower() 
+        void ToLower()
         {
             std::unique_lock lock(*mutex);
-            std::ranges::transform(data, data.begin(), [](T ch) -> T 
+            std::ranges::transform(data, data.begin(), [](T ch) -> T
             {
-                if constexpr (std::is_same_v<T, char>) 
+                if constexpr (std::is_same_v<T, char>)
                     return static_cast<T>(std::tolower(static_cast<unsigned char>(ch)));
-                else 
+                else
                     return static_cast<T>(std::tolower(ch));
             });
         }
 
-		template <typename U> requires ConvertibleCharTypes<U, T>
-		bool Contains(const BasicString<U>& other) const
+		template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+		bool Contains(const BasicString<U, L, A>& other) const
 		{
-			BasicString<T> otherConverted(other);
-			std::scoped_lock lock(*mutex, *otherConverted.mutex);
+            if (IsSameObject(other))
+                return true;
 
-			return data.find(otherConverted.data) != std::basic_string<T>::npos;
+            auto otherData = Snapshot(other);
+
+			return Find(ConvertView<U>(otherData), 0) != NullPosition;
 		}
 
 		template <typename U> requires ConvertibleCharTypes<U, T>
         bool Contains(const std::basic_string<U>& other) const
         {
-			BasicString<T> otherConverted(other);
-			std::scoped_lock lock(*mutex, *otherConverted.mutex);
-
-			return data.find(otherConverted.data) != std::basic_string<T>::npos;
+			return Find(ConvertView<U>(other), 0) != NullPosition;
         }
 
 		template <typename U> requires ConvertibleCharTypes<U, T>
         bool Contains(const U* other) const
         {
-            BasicString<T> otherConverted(other);
-            std::scoped_lock lock(*mutex, *otherConverted.mutex);
-
-            return data.find(otherConverted.data) != std::basic_string<T>::npos;
+            return Find(ConvertView<U>(other), 0) != NullPosition;
         }
 
 		template <typename U> requires ConvertibleCharTypes<U, T>
-		BasicString<U> SubString(size_t start, size_t length) const
+		BasicString<U, Lock> SubString(size_t start, size_t length) const
 		{
 			std::shared_lock lock(*mutex);
 
-			return BasicString(data.substr(start, length));
+			return BasicString<U, Lock>(ViewType(data).substr(start, length));
 		}
 
         template <typename U> requires ConvertibleCharTypes<U, T>
-		BasicString<U> SubString(size_t start) const
+		BasicString<U, Lock> SubString(size_t start) const
 		{
 			std::shared_lock lock(*mutex);
 
-			return BasicString(data.substr(start));
+			return BasicString<U, Lock>(ViewType(data).substr(start));
 		}
 
-        [[nodiscard]] AtomicIterator<typename std::basic_string<T>::iterator> begin() noexcept
+        [[nodiscard]] typename Lock::template IteratorType<typename StringType::iterator> begin() noexcept
         {
             std::shared_lock lock(*mutex);
-            return AtomicIterator<typename std::basic_string<T>::iterator>(data.begin(), mutex);
+            return mutex.Wrap(data.begin());
         }
 
-        [[nodiscard]] AtomicIterator<typename std::basic_string<T>::iterator> end() noexcept
+        [[nodiscard]] typename Lock::template IteratorType<typename StringType::iterator> end() noexcept
         {
             std::shared_lock lock(*mutex);
-            return AtomicIterator<typename std::basic_string<T>::iterator>(data.end(), mutex);
+            return mutex.Wrap(data.end());
         }
 
-        [[nodiscard]] AtomicIterator<typename std::basic_string<T>::const_iterator> cbegin() const noexcept 
+        [[nodiscard]] typename Lock::template IteratorType<typename StringType::const_iterator> cbegin() const noexcept
         {
             std::shared_lock lock(*mutex);
-            return AtomicIterator<typename std::basic_string<T>::const_iterator>(data.cbegin(), mutex);
+            return mutex.Wrap(data.cbegin());
         }
 
-        [[nodiscard]] AtomicIterator<typename std::basic_string<T>::const_iterator> cend() const noexcept 
+        [[nodiscard]] typename Lock::template IteratorType<typename StringType::const_iterator> cend() const noexcept
         {
             std::shared_lock lock(*mutex);
-            return AtomicIterator<typename std::basic_string<T>::const_iterator>(data.cend(), mutex);
-        }
-
-        [[nodiscard]] AtomicIterator<typename std::basic_string<T>::iterator> find() const noexcept
-        {
-			std::shared_lock lock(*mutex);
-			return AtomicIterator<typename std::basic_string<T>::iterator>(data.find(), mutex);
+            return mutex.Wrap(data.cend());
         }
 
-		template <typename U> requires ConvertibleCharTypes<U, T>
-		[[nodiscard]] AtomicIterator<typename std::basic_string<T>::iterator> find(const BasicString<U>& str) const noexcept
+		template <typename U, LockPolicy L, typename A> requires ConvertibleCharTypes<U, T>
+		[[nodiscard]] size_t find(const BasicString<U, L, A>& str, size_t position = 0) const
 		{
-			BasicString<T> strConverted(str);
+            if (IsSameObject(str))
+                return position == 0 ? 0 : NullPosition;
 
-			std::shared_lock lock(*mutex);
+            auto strData = Snapshot(str);
 
-			return AtomicIterator<typename std::basic_string<T>::iterator>(data.find(strConverted.data), mutex);
+            return Find(ConvertView<U>(strData), position);
 		}
 
-        [[nodiscard]] size_t find(char c, size_t input) const noexcept
+        [[nodiscard]] size_t find(T c, size_t input) const noexcept
         {
             std::shared_lock lock(*mutex);
 
             return data.find(c, input);
         }
 
-        [[nodiscard]] size_t Length() const 
+        [[nodiscard]] size_t Length() const
         {
             std::shared_lock lock(*mutex);
             return data.length();
@@ -674,26 +585,140 @@ namespace Invasion::Util::Types
             return data.empty();
         }
 
-        void Clear() 
+        [[nodiscard]] ViewType View() const noexcept requires (!Lock::IsSynchronized)
+        {
+            return data;
+        }
+
+        void Clear()
         {
             std::unique_lock lock(*mutex);
             data.clear();
         }
 
         template <typename U> requires ConvertibleCharTypes<T, U>
-        operator std::basic_string<U>() const 
+        operator std::basic_string<U>() const
         {
             std::shared_lock lock(*mutex);
 
-            return Convert<T, U>(data);
+            return Convert<T, U>(ViewType(data));
         }
 
-		static const size_t NullPosition = std::basic_string<T>::npos;
+		static const size_t NullPosition = StringType::npos;
 
     private:
-        
+
+        template <CharType, LockPolicy, typename>
+        friend class BasicString;
+
+        template <typename Source>
+        void Assign(Source&& source)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<Source>, StringType>)
+                data = std::forward<Source>(source);
+            else
+                data.assign(source.data(), source.size());
+        }
+
+        template <typename U, LockPolicy L, typename A>
+        bool IsSameObject(const BasicString<U, L, A>& other) const noexcept
+        {
+            return static_cast<const void*>(this) == static_cast<const void*>(&other);
+        }
+
+        template <typename U, LockPolicy L, typename A>
+        static auto Snapshot(const BasicString<U, L, A>& other)
+        {
+            if constexpr (L::IsSynchronized)
+            {
+                std::shared_lock lock(*other.mutex);
+
+                return std::basic_string<U>(other.data);
+            }
+            else
+                return std::basic_string_view<U>(other.data);
+        }
+
+        template <typename U, typename Source>
+        static auto ConvertView(const Source& source)
+        {
+            std::basic_string_view<U> view(source);
+
+            if constexpr (std::is_same_v<U, T>)
+                return view;
+            else
+                return Convert<U, T>(view);
+        }
+
+        template <typename Source>
+        int Compare(const Source& other) const
+        {
+            std::shared_lock lock(*mutex);
+
+            return ViewType(data).compare(ViewType(other));
+        }
+
+        template <typename Source>
+        size_t Find(const Source& other, size_t position) const
+        {
+            std::shared_lock lock(*mutex);
+
+            return data.find(ViewType(other), position);
+        }
+
+        template <typename Source>
+        BasicString& Append(const Source& other)
+        {
+            std::unique_lock lock(*mutex);
+
+            data.append(ViewType(other));
+
+            return *this;
+        }
+
+        template <typename Source>
+        BasicString& Remove(const Source& other)
+        {
+            StringType pattern{ ViewType(other) };
+
+            if (pattern.empty())
+                return *this;
+
+            std::unique_lock lock(*mutex);
+
+            size_t pos = data.find(pattern);
+
+            while (pos != StringType::npos)
+            {
+                data.erase(pos, pattern.length());
+                pos = data.find(pattern, pos);
+            }
+
+            return *this;
+        }
+
+        template <typename Find, typename Replacement>
+        void Replace(const Find& find, const Replacement& replace)
+        {
+            StringType findString{ ViewType(find) };
+            StringType replaceString{ ViewType(replace) };
+
+            if (findString.empty())
+                return;
+
+            std::unique_lock lock(*mutex);
+
+            size_t pos = 0;
+
+            while ((pos = data.find(findString, pos)) != StringType::npos)
+            {
+                data.replace(pos, findString.length(), replaceString);
+                pos += replaceString.length();
+            }
+        }
+
         template <typename From, typename To> requires ConvertibleCharTypes<From, To>
-        std::basic_string<To> Convert(const std::basic_string<From>& from) const
+        static std::basic_string<To> Convert(std::basic_string_view<From> from)
         {
             static_assert(
                 std::is_same_v<From, char> || std::is_same_v<From, wchar_t> ||
@@ -708,32 +733,44 @@ namespace Invasion::Util::Types
                 );
 
             if constexpr (std::is_same_v<From, To>)
-                return from;
+                return std::basic_string<To>(from);
 
             else if constexpr (std::is_same_v<From, char> && std::is_same_v<To, wchar_t>)
             {
                 std::wstring result(from.size() + 1, L'\0');
 
+#ifdef _WIN32
                 size_t convertedChars = 0;
-                errno_t error = mbstowcs_s(&convertedChars, result.data(), result.size(), from.c_str(), from.size());
+                errno_t error = mbstowcs_s(&convertedChars, result.data(), result.size(), from.data(), from.size());
 
                 if (error != 0)
                     throw std::runtime_error("Failed to convert string from char to wchar_t.");
 
                 result.resize(convertedChars - 1);
+#else
+                std::string source(from);
+
+                size_t convertedChars = std::mbstowcs(result.data(), source.c_str(), result.size());
+
+                if (convertedChars == static_cast<size_t>(-1))
+                    throw std::runtime_error("Failed to convert string from char to wchar_t.");
+
+                result.resize(convertedChars);
+#endif
 
                 return result;
             }
             else if constexpr (std::is_same_v<From, wchar_t> && std::is_same_v<To, char>)
             {
+                std::wstring source(from);
                 std::string result;
                 size_t convertedChars = 0;
 
-                size_t bufferSize = from.size() * MB_CUR_MAX + 1;
+                size_t bufferSize = source.size() * MB_CUR_MAX + 1;
 
                 result.resize(bufferSize);
 
-                convertedChars = std::wcstombs(result.data(), from.c_str(), bufferSize - 1);
+                convertedChars = std::wcstombs(result.data(), source.c_str(), bufferSize - 1);
 
                 if (convertedChars == static_cast<size_t>(-1))
                     throw std::runtime_error("Conversion failed.");
@@ -743,7 +780,7 @@ namespace Invasion::Util::Types
             }
             else
             {
-                std::cout << std::format("Unsupported character conversion. Conversion between '{}' and '{}'.", typeid(From).name(), typeid(To).name()) << std::endl;
+                std::cout << "Unsupported character conversion. Conversion between '" << typeid(From).name() << "' and '" << typeid(To).name() << "'." << std::endl;
                 throw std::runtime_error("Unsupported character conversion.");
             }
         }
@@ -754,16 +791,21 @@ namespace Invasion::Util::Types
         template <typename U>
         friend struct std::equal_to;
 
+#if __has_include(<format>)
         template <typename U, typename Char>
         friend struct std::formatter;
+#endif
+
+        template <CharType U, LockPolicy L, typename A>
+        friend std::basic_ostream<U>& operator<<(std::basic_ostream<U>& stream, const BasicString<U, L, A>& str);
 
-        std::shared_ptr<std::shared_mutex> mutex = std::make_shared<std::shared_mutex>();
+        [[no_unique_address]] mutable Lock mutex;
 
-        std::basic_string<T> data;
+        StringType data;
     };
 
-    template <CharType T>
-    std::basic_ostream<T>& operator<<(std::basic_ostream<T>& stream, const BasicString<T>& str) 
+    template <CharType T, LockPolicy Lock, typename Allocator>
+    std::basic_ostream<T>& operator<<(std::basic_ostream<T>& stream, const BasicString<T, Lock, Allocator>& str)
     {
         std::shared_lock lock(*str.mutex);
 
@@ -878,36 +920,38 @@ namespace Invasion::Util::Types
 
 namespace std
 {
-	template <typename T>
-	struct hash<Invasion::Util::Types::BasicString<T>>
+	template <typename T, typename Lock, typename Allocator>
+	struct hash<Invasion::Util::Types::BasicString<T, Lock, Allocator>>
 	{
-		size_t operator()(const Invasion::Util::Types::BasicString<T>& str) const
+		size_t operator()(const Invasion::Util::Types::BasicString<T, Lock, Allocator>& str) const
 		{
-			std::shared_lock<std::shared_mutex> lock(*str.mutex);
-			return std::hash<std::basic_string<T>>()(str.data);
+			std::shared_lock lock(*str.mutex);
+			return std::hash<std::basic_string_view<T>>()(str.data);
 		}
 	};
 
-	template <typename T>
-	struct equal_to<Invasion::Util::Types::BasicString<T>>
+	template <typename T, typename Lock, typename Allocator>
+	struct equal_to<Invasion::Util::Types::BasicString<T, Lock, Allocator>>
 	{
-		bool operator()(const Invasion::Util::Types::BasicString<T>& lhs, const Invasion::Util::Types::BasicString<T>& rhs) const
+		bool operator()(const Invasion::Util::Types::BasicString<T, Lock, Allocator>& lhs, const Invasion::Util::Types::BasicString<T, Lock, Allocator>& rhs) const
 		{
 			return lhs.data == rhs.data;
 		}
 	};
 
-    template <typename T, typename Char>
-    struct formatter<Invasion::Util::Types::BasicString<T>, Char> : formatter<std::basic_string<T>, Char>
+#if __has_include(<format>)
+    template <typename T, typename Lock, typename Allocator, typename Char>
+    struct formatter<Invasion::Util::Types::BasicString<T, Lock, Allocator>, Char> : formatter<std::basic_string_view<T>, Char>
     {
-        using formatter<std::basic_string<T>, Char>::formatter;
+        using formatter<std::basic_string_view<T>, Char>::formatter;
 
         template <typename FormatContext>
-        auto format(const Invasion::Util::Types::BasicString<T>& str, FormatContext& ctx) const noexcept
+        auto format(const Invasion::Util::Types::BasicString<T, Lock, Allocator>& str, FormatContext& ctx) const noexcept
         {
             std::shared_lock lock(*str.mutex);
 
-            return formatter<std::basic_string<T>, Char>::format(str.data, ctx);
+            return formatter<std::basic_string_view<T>, Char>::format(std::basic_string_view<T>(str.data), ctx);
         }
     };
+#endif
 }
\ No newline at end of file
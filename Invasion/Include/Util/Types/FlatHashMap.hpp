@@ -0,0 +1,652 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define INVASION_FLAT_HASH_MAP_SSE2 1
+#endif
+
+namespace Invasion::Util::Types
+{
+    class FlatHashMapGroup
+    {
+
+    public:
+
+        static constexpr size_t Width = 16;
+
+        static constexpr int8_t Empty = -128;
+        static constexpr int8_t Deleted = -2;
+
+        explicit FlatHashMapGroup(const int8_t* control) noexcept
+        {
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+            bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(control));
+#else
+            std::memcpy(bytes, control, Width);
+#endif
+        }
+
+        [[nodiscard]] uint32_t Match(int8_t hash) const noexcept
+        {
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(hash))));
+#else
+            uint32_t mask = 0;
+
+            for (size_t i = 0; i < Width; i++)
+                mask |= static_cast<uint32_t>(bytes[i] == hash) << i;
+
+            return mask;
+#endif
+        }
+
+        [[nodiscard]] uint32_t MatchEmpty() const noexcept
+        {
+            return Match(Empty);
+        }
+
+        [[nodiscard]] uint32_t MatchEmptyOrDeleted() const noexcept
+        {
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+            return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+#else
+            uint32_t mask = 0;
+
+            for (size_t i = 0; i < Width; i++)
+                mask |= static_cast<uint32_t>(bytes[i] < 0) << i;
+
+            return mask;
+#endif
+        }
+
+    private:
+
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+        __m128i bytes;
+#else
+        int8_t bytes[Width];
+#endif
+
+    };
+
+    template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class FlatHashMap
+    {
+
+    public:
+
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<const Key, Value>;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+    private:
+
+        union Slot
+        {
+            Slot() noexcept { }
+            ~Slot() { }
+
+            value_type value;
+        };
+
+        template <bool IsConst>
+        class Iterator
+        {
+
+        public:
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = FlatHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+            using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+            Iterator() noexcept = default;
+
+            template <bool OtherConst> requires (IsConst && !OtherConst)
+            Iterator(const Iterator<OtherConst>& other) noexcept : control(other.control), slot(other.slot) { }
+
+            reference operator*() const noexcept
+            {
+                return slot->value;
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &slot->value;
+            }
+
+            Iterator& operator++() noexcept
+            {
+                ++control;
+                ++slot;
+
+                SkipEmpty();
+
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept
+            {
+                Iterator temp = *this;
+
+                ++*this;
+
+                return temp;
+            }
+
+            bool operator==(const Iterator& other) const noexcept
+            {
+                return slot == other.slot;
+            }
+
+            bool operator!=(const Iterator& other) const noexcept
+            {
+                return slot != other.slot;
+            }
+
+        private:
+
+            friend class FlatHashMap;
+
+            template <bool>
+            friend class Iterator;
+
+            using SlotPointer = std::conditional_t<IsConst, const Slot*, Slot*>;
+
+            Iterator(const int8_t* control, SlotPointer slot) noexcept : control(control), slot(slot)
+            {
+                SkipEmpty();
+            }
+
+            void SkipEmpty() noexcept
+            {
+                while (*control < 0 && *control != Sentinel)
+                {
+                    ++control;
+                    ++slot;
+                }
+            }
+
+            const int8_t* control = nullptr;
+            SlotPointer slot = nullptr;
+
+        };
+
+    public:
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        FlatHashMap() = default;
+
+        FlatHashMap(const FlatHashMap& other) : hash(other.hash), equal(other.equal)
+        {
+            Reserve(other.count);
+
+            for (const value_type& value : other)
+                InsertUnique(HashOf(value.first), value);
+        }
+
+        FlatHashMap(FlatHashMap&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        ~FlatHashMap()
+        {
+            Destroy();
+        }
+
+        FlatHashMap& operator=(const FlatHashMap& other)
+        {
+            if (this != &other)
+            {
+                FlatHashMap copy(other);
+                Swap(copy);
+            }
+
+            return *this;
+        }
+
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Destroy();
+                Swap(other);
+            }
+
+            return *this;
+        }
+
+        bool operator==(const FlatHashMap& other) const
+        {
+            if (count != other.count)
+                return false;
+
+            for (const value_type& value : *this)
+            {
+                const_iterator match = other.find(value.first);
+
+                if (match == other.end() || !(match->second == value.second))
+                    return false;
+            }
+
+            return true;
+        }
+
+        Value& operator[](const Key& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        Value& at(const Key& key)
+        {
+            iterator result = find(key);
+
+            if (result == end())
+                throw std::out_of_range("FlatHashMap::at: key not found.");
+
+            return result->second;
+        }
+
+        const Value& at(const Key& key) const
+        {
+            const_iterator result = find(key);
+
+            if (result == end())
+                throw std::out_of_range("FlatHashMap::at: key not found.");
+
+            return result->second;
+        }
+
+        template <typename... Arguments>
+        std::pair<iterator, bool> try_emplace(const Key& key, Arguments&&... arguments)
+        {
+            size_t keyHash = HashOf(key);
+            size_t index = FindIndex(key, keyHash);
+
+            if (index != NullIndex)
+                return { MakeIterator(index), false };
+
+            return { MakeIterator(InsertUnique(keyHash, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Arguments>(arguments)...))), true };
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value)
+        {
+            size_t keyHash = HashOf(value.first);
+            size_t index = FindIndex(value.first, keyHash);
+
+            if (index != NullIndex)
+                return { MakeIterator(index), false };
+
+            return { MakeIterator(InsertUnique(keyHash, value)), true };
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value)
+        {
+            size_t keyHash = HashOf(value.first);
+            size_t index = FindIndex(value.first, keyHash);
+
+            if (index != NullIndex)
+                return { MakeIterator(index), false };
+
+            return { MakeIterator(InsertUnique(keyHash, std::move(value))), true };
+        }
+
+        size_t erase(const Key& key)
+        {
+            size_t index = FindIndex(key, HashOf(key));
+
+            if (index == NullIndex)
+                return 0;
+
+            EraseIndex(index);
+
+            return 1;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            size_t index = static_cast<size_t>(position.slot - slots);
+
+            EraseIndex(index);
+
+            return MakeIterator(index + 1);
+        }
+
+        [[nodiscard]] iterator find(const Key& key)
+        {
+            size_t index = FindIndex(key, HashOf(key));
+
+            return index == NullIndex ? end() : MakeIterator(index);
+        }
+
+        [[nodiscard]] const_iterator find(const Key& key) const
+        {
+            size_t index = FindIndex(key, HashOf(key));
+
+            return index == NullIndex ? end() : MakeIterator(index);
+        }
+
+        [[nodiscard]] bool contains(const Key& key) const
+        {
+            return FindIndex(key, HashOf(key)) != NullIndex;
+        }
+
+        void clear() noexcept
+        {
+            if (capacity == 0)
+                return;
+
+            DestroySlots();
+
+            std::memset(control, FlatHashMapGroup::Empty, capacity);
+
+            count = 0;
+            growthLeft = MaxLoad(capacity);
+        }
+
+        void reserve(size_t size)
+        {
+            Reserve(size);
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return count;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return count == 0;
+        }
+
+        [[nodiscard]] size_t bucket_count() const noexcept
+        {
+            return capacity;
+        }
+
+        [[nodiscard]] iterator begin() noexcept
+        {
+            return MakeIterator(0);
+        }
+
+        [[nodiscard]] iterator end() noexcept
+        {
+            return MakeIterator(capacity);
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return MakeIterator(0);
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return MakeIterator(capacity);
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+    private:
+
+        static constexpr int8_t Sentinel = -1;
+        static constexpr size_t NullIndex = static_cast<size_t>(-1);
+
+        static constexpr size_t MaxLoad(size_t capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        FlatHashMap(const Hash& hash, const KeyEqual& equal) : hash(hash), equal(equal) { }
+
+        size_t HashOf(const Key& key) const
+        {
+            uint64_t value = static_cast<uint64_t>(hash(key)) * 0x9E3779B97F4A7C15ull;
+
+            return static_cast<size_t>(value ^ (value >> 32));
+        }
+
+        static int8_t H2(size_t keyHash) noexcept
+        {
+            return static_cast<int8_t>(keyHash & 0x7F);
+        }
+
+        size_t GroupMask() const noexcept
+        {
+            return capacity / FlatHashMapGroup::Width - 1;
+        }
+
+        size_t FindIndex(const Key& key, size_t keyHash) const
+        {
+            if (capacity == 0)
+                return NullIndex;
+
+            size_t mask = GroupMask();
+            size_t group = (keyHash >> 7) & mask;
+
+            for (size_t step = 1; ; step++)
+            {
+                size_t base = group * FlatHashMapGroup::Width;
+                FlatHashMapGroup bytes(control + base);
+
+                for (uint32_t match = bytes.Match(H2(keyHash)); match != 0; match &= match - 1)
+                {
+                    size_t index = base + static_cast<size_t>(std::countr_zero(match));
+
+                    if (equal(slots[index].value.first, key))
+                        return index;
+                }
+
+                if (bytes.MatchEmpty() != 0 || step > mask)
+                    return NullIndex;
+
+                group = (group + step) & mask;
+            }
+        }
+
+        size_t FindInsertIndex(size_t keyHash) const noexcept
+        {
+            size_t mask = GroupMask();
+            size_t group = (keyHash >> 7) & mask;
+
+            for (size_t step = 1; ; step++)
+            {
+                size_t base = group * FlatHashMapGroup::Width;
+                uint32_t match = FlatHashMapGroup(control + base).MatchEmptyOrDeleted();
+
+                if (match != 0)
+                    return base + static_cast<size_t>(std::countr_zero(match));
+
+                group = (group + step) & mask;
+            }
+        }
+
+        template <typename... Arguments>
+        size_t InsertUnique(size_t keyHash, Arguments&&... arguments)
+        {
+            if (growthLeft == 0)
+                Rehash(capacity == 0 ? FlatHashMapGroup::Width : (count + 1 > MaxLoad(capacity) / 2 ? capacity * 2 : capacity));
+
+            size_t index = FindInsertIndex(keyHash);
+
+            ::new (static_cast<void*>(&slots[index].value)) value_type(std::forward<Arguments>(arguments)...);
+
+            if (control[index] == FlatHashMapGroup::Empty)
+                growthLeft--;
+
+            control[index] = H2(keyHash);
+            count++;
+
+            return index;
+        }
+
+        void EraseIndex(size_t index)
+        {
+            slots[index].value.~value_type();
+
+            size_t base = index - index % FlatHashMapGroup::Width;
+
+            if (FlatHashMapGroup(control + base).MatchEmpty() != 0)
+            {
+                control[index] = FlatHashMapGroup::Empty;
+                growthLeft++;
+            }
+            else
+                control[index] = FlatHashMapGroup::Deleted;
+
+            count--;
+        }
+
+        void Reserve(size_t size)
+        {
+            size_t required = FlatHashMapGroup::Width;
+
+            while (MaxLoad(required) < size)
+                required *= 2;
+
+            if (required > capacity)
+                Rehash(required);
+        }
+
+        // Builds the new table in separate storage and swaps it in only once every element has been
+        // transferred, so an exception from allocation or from copying a value leaves the map unchanged.
+        // Values are moved instead of copied when that cannot throw; like std::unordered_map, a throwing
+        // Hash is the one case this does not cover.
+        void Rehash(size_t newCapacity)
+        {
+            constexpr bool Relocate = (std::is_nothrow_move_constructible_v<Key> && std::is_nothrow_move_constructible_v<Value>) || !std::is_copy_constructible_v<value_type>;
+
+            FlatHashMap table(hash, equal);
+
+            table.Allocate(newCapacity);
+
+            for (size_t i = 0; i < capacity; i++)
+            {
+                if (control[i] < 0)
+                    continue;
+
+                value_type& value = slots[i].value;
+                size_t keyHash = HashOf(value.first);
+                size_t index = table.FindInsertIndex(keyHash);
+
+                if constexpr (Relocate)
+                    ::new (static_cast<void*>(&table.slots[index].value)) value_type(std::move(const_cast<Key&>(value.first)), std::move(value.second));
+                else
+                    ::new (static_cast<void*>(&table.slots[index].value)) value_type(value);
+
+                table.control[index] = H2(keyHash);
+                table.count++;
+                table.growthLeft--;
+            }
+
+            Swap(table);
+        }
+
+        void Allocate(size_t newCapacity)
+        {
+            control = static_cast<int8_t*>(::operator new(newCapacity + FlatHashMapGroup::Width, std::align_val_t(FlatHashMapGroup::Width)));
+            slots = std::allocator<Slot>().allocate(newCapacity);
+            capacity = newCapacity;
+            growthLeft = MaxLoad(newCapacity);
+
+            std::memset(control, FlatHashMapGroup::Empty, newCapacity);
+            std::memset(control + newCapacity, Sentinel, FlatHashMapGroup::Width);
+        }
+
+        void DestroySlots() noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<value_type>)
+            {
+                for (size_t i = 0; i < capacity; i++)
+                {
+                    if (control[i] >= 0)
+                        slots[i].value.~value_type();
+                }
+            }
+        }
+
+        void Destroy() noexcept
+        {
+            if (control == nullptr)
+                return;
+
+            DestroySlots();
+
+            ::operator delete(control, std::align_val_t(FlatHashMapGroup::Width));
+            std::allocator<Slot>().deallocate(slots, capacity);
+
+            control = nullptr;
+            slots = nullptr;
+            capacity = 0;
+            count = 0;
+            growthLeft = 0;
+        }
+
+        void Swap(FlatHashMap& other) noexcept
+        {
+            std::swap(control, other.control);
+            std::swap(slots, other.slots);
+            std::swap(capacity, other.capacity);
+            std::swap(count, other.count);
+            std::swap(growthLeft, other.growthLeft);
+            std::swap(hash, other.hash);
+            std::swap(equal, other.equal);
+        }
+
+        iterator MakeIterator(size_t index) noexcept
+        {
+            return control ? iterator(control + index, slots + index) : iterator(EmptyControl(), nullptr);
+        }
+
+        const_iterator MakeIterator(size_t index) const noexcept
+        {
+            return control ? const_iterator(control + index, slots + index) : const_iterator(EmptyControl(), nullptr);
+        }
+
+        static const int8_t* EmptyControl() noexcept
+        {
+            static constexpr int8_t sentinel = Sentinel;
+
+            return &sentinel;
+        }
+
+        int8_t* control = nullptr;
+        Slot* slots = nullptr;
+
+        size_t capacity = 0;
+        size_t count = 0;
+        size_t growthLeft = 0;
+
+        [[no_unique_address]] Hash hash;
+        [[no_unique_address]] KeyEqual equal;
+
+    };
+}
\ No newline at end of file
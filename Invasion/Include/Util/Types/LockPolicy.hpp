@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include "Util/AtomicIterator.hpp"
+
+namespace Invasion::Util::Types
+{
+    class NullMutex
+    {
+
+    public:
+
+        constexpr void lock() noexcept { }
+        constexpr void unlock() noexcept { }
+        constexpr bool try_lock() noexcept { return true; }
+
+        constexpr void lock_shared() noexcept { }
+        constexpr void unlock_shared() noexcept { }
+        constexpr bool try_lock_shared() noexcept { return true; }
+    };
+
+    class SpinMutex
+    {
+
+    public:
+
+        SpinMutex() = default;
+
+        SpinMutex(const SpinMutex&) = delete;
+        SpinMutex& operator=(const SpinMutex&) = delete;
+
+        void lock() noexcept
+        {
+            while (!try_lock())
+                Pause();
+        }
+
+        bool try_lock() noexcept
+        {
+            int32_t expected = 0;
+
+            return state.compare_exchange_weak(expected, Writer, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        void unlock() noexcept
+        {
+            state.store(0, std::memory_order_release);
+        }
+
+        void lock_shared() noexcept
+        {
+            while (!try_lock_shared())
+                Pause();
+        }
+
+        bool try_lock_shared() noexcept
+        {
+            int32_t expected = state.load(std::memory_order_relaxed);
+
+            return expected != Writer && state.compare_exchange_weak(expected, expected + 1, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        void unlock_shared() noexcept
+        {
+            state.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+
+        static void Pause() noexcept
+        {
+            std::this_thread::yield();
+        }
+
+        static constexpr int32_t Writer = -1;
+
+        std::atomic<int32_t> state = 0;
+    };
+
+    template <typename Mutex>
+    class BasicLockPolicy
+    {
+
+    public:
+
+        using MutexType = Mutex;
+
+        template <typename Iterator>
+        using IteratorType = AtomicIterator<Iterator, Mutex>;
+
+        static constexpr bool IsSynchronized = true;
+
+        BasicLockPolicy() = default;
+
+        BasicLockPolicy(const BasicLockPolicy&) : mutex(std::make_shared<Mutex>()) { }
+
+        BasicLockPolicy& operator=(const BasicLockPolicy&) noexcept
+        {
+            return *this;
+        }
+
+        Mutex& operator*() const noexcept
+        {
+            return *mutex;
+        }
+
+        template <typename Iterator>
+        IteratorType<Iterator> Wrap(Iterator iterator) const
+        {
+            return IteratorType<Iterator>(iterator, mutex);
+        }
+
+    private:
+
+        std::shared_ptr<Mutex> mutex = std::make_shared<Mutex>();
+
+    };
+
+    class NoLock
+    {
+
+    public:
+
+        using MutexType = NullMutex;
+
+        template <typename Iterator>
+        using IteratorType = Iterator;
+
+        static constexpr bool IsSynchronized = false;
+
+        NullMutex& operator*() const noexcept
+        {
+            return mutex;
+        }
+
+        template <typename Iterator>
+        constexpr Iterator Wrap(Iterator iterator) const noexcept
+        {
+            return iterator;
+        }
+
+    private:
+
+        static inline NullMutex mutex;
+
+    };
+
+    using SharedMutexLock = BasicLockPolicy<std::shared_mutex>;
+    using SpinLock = BasicLockPolicy<SpinMutex>;
+
+    template <typename T>
+    concept LockPolicy = requires(const T policy)
+    {
+        typename T::MutexType;
+        { *policy } -> std::same_as<typename T::MutexType&>;
+        { T::IsSynchronized } -> std::convertible_to<bool>;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <mutex>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
+#include <type_traits>
+
+namespace Invasion::Util::Types
+{
+    template <typename View, typename Mutex, bool Exclusive>
+    class LockedView
+    {
+
+    public:
+
+        using ViewType = View;
+        using GuardType = std::conditional_t<Exclusive, std::unique_lock<Mutex>, std::shared_lock<Mutex>>;
+
+        LockedView(Mutex& mutex, View view) : guard(mutex), view(view) { }
+
+        LockedView(const LockedView&) = delete;
+        LockedView& operator=(const LockedView&) = delete;
+
+        LockedView(LockedView&&) noexcept = default;
+        LockedView& operator=(LockedView&&) noexcept = default;
+
+        [[nodiscard]] auto begin() const
+        {
+            return std::ranges::begin(view);
+        }
+
+        [[nodiscard]] auto end() const
+        {
+            return std::ranges::end(view);
+        }
+
+        [[nodiscard]] size_t Length() const
+        {
+            return static_cast<size_t>(std::ranges::size(view));
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return std::ranges::empty(view);
+        }
+
+        [[nodiscard]] decltype(auto) operator[](size_t index) const requires std::ranges::random_access_range<const View>
+        {
+            return view[index];
+        }
+
+        [[nodiscard]] const View& operator*() const noexcept
+        {
+            return view;
+        }
+
+        [[nodiscard]] const View* operator->() const noexcept
+        {
+            return &view;
+        }
+
+    private:
+
+        GuardType guard;
+        View view;
+
+    };
+
+    template <typename T, typename Mutex>
+    using ReadSpan = LockedView<std::span<const T>, Mutex, false>;
+
+    template <typename T, typename Mutex>
+    using WriteSpan = LockedView<std::span<T>, Mutex, true>;
+
+    template <typename Container, typename Mutex>
+    using ReadRange = LockedView<std::ranges::ref_view<const Container>, Mutex, false>;
+
+    template <typename Container, typename Mutex>
+    using WriteRange = LockedView<std::ranges::ref_view<Container>, Mutex, true>;
+}
\ No newline at end of file
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Invasion::Util::Types
+{
+    template <typename T, size_t N> requires (N > 0)
+    class SmallVector
+    {
+
+    public:
+
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        static constexpr size_t InlineCapacity = N;
+
+        SmallVector() noexcept = default;
+
+        explicit SmallVector(size_t size)
+        {
+            resize(size);
+        }
+
+        SmallVector(std::initializer_list<T> list)
+        {
+            assign(list.begin(), list.end());
+        }
+
+        SmallVector(const SmallVector& other)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            MoveFrom(std::move(other));
+        }
+
+        ~SmallVector()
+        {
+            clear();
+            Release();
+        }
+
+        SmallVector& operator=(const SmallVector& other)
+        {
+            if (this != &other)
+                assign(other.begin(), other.end());
+
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            if (this != &other)
+            {
+                clear();
+                Release();
+                MoveFrom(std::move(other));
+            }
+
+            return *this;
+        }
+
+        SmallVector& operator=(std::initializer_list<T> list)
+        {
+            assign(list.begin(), list.end());
+
+            return *this;
+        }
+
+        bool operator==(const SmallVector& other) const
+        {
+            return std::equal(begin(), end(), other.begin(), other.end());
+        }
+
+        bool operator<(const SmallVector& other) const
+        {
+            return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+        }
+
+        T& operator[](size_t index) noexcept
+        {
+            return first[index];
+        }
+
+        const T& operator[](size_t index) const noexcept
+        {
+            return first[index];
+        }
+
+        T& at(size_t index)
+        {
+            if (index >= count)
+                throw std::out_of_range("SmallVector::at: index out of range.");
+
+            return first[index];
+        }
+
+        const T& at(size_t index) const
+        {
+            if (index >= count)
+                throw std::out_of_range("SmallVector::at: index out of range.");
+
+            return first[index];
+        }
+
+        template <typename InputIterator>
+        void assign(InputIterator begin, InputIterator end)
+        {
+            clear();
+            insert(this->end(), begin, end);
+        }
+
+        template <typename... Arguments>
+        T& emplace_back(Arguments&&... arguments)
+        {
+            if (count == reserved)
+            {
+                T value(std::forward<Arguments>(arguments)...);
+
+                Grow(count + 1);
+
+                return *::new (static_cast<void*>(first + count++)) T(std::move(value));
+            }
+
+            return *::new (static_cast<void*>(first + count++)) T(std::forward<Arguments>(arguments)...);
+        }
+
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        void pop_back() noexcept
+        {
+            first[--count].~T();
+        }
+
+        template <typename InputIterator>
+        iterator insert(const_iterator position, InputIterator begin, InputIterator end)
+        {
+            size_t offset = static_cast<size_t>(position - first);
+
+            SmallVector pending;
+
+            for (; begin != end; ++begin)
+                pending.emplace_back(*begin);
+
+            if (pending.count == 0)
+                return first + offset;
+
+            reserve(count + pending.count);
+
+            size_t oldCount = count;
+
+            for (T& value : pending)
+                ::new (static_cast<void*>(first + count++)) T(std::move(value));
+
+            std::rotate(first + offset, first + oldCount, first + count);
+
+            return first + offset;
+        }
+
+        iterator insert(const_iterator position, const T& value)
+        {
+            return insert(position, &value, &value + 1);
+        }
+
+        iterator erase(const_iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        iterator erase(const_iterator begin, const_iterator end)
+        {
+            iterator target = first + (begin - first);
+            iterator source = first + (end - first);
+
+            if (target == source)
+                return target;
+
+            iterator newEnd = std::move(source, first + count, target);
+
+            std::destroy(newEnd, first + count);
+
+            count = static_cast<size_t>(newEnd - first);
+
+            return target;
+        }
+
+        void clear() noexcept
+        {
+            std::destroy(first, first + count);
+            count = 0;
+        }
+
+        void reserve(size_t size)
+        {
+            if (size > reserved)
+                Grow(size);
+        }
+
+        void resize(size_t size)
+        {
+            if (size < count)
+            {
+                std::destroy(first + size, first + count);
+                count = size;
+
+                return;
+            }
+
+            reserve(size);
+
+            std::uninitialized_value_construct(first + count, first + size);
+            count = size;
+        }
+
+        [[nodiscard]] T* data() noexcept
+        {
+            return first;
+        }
+
+        [[nodiscard]] const T* data() const noexcept
+        {
+            return first;
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return count;
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            return reserved;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return count == 0;
+        }
+
+        [[nodiscard]] bool IsInline() const noexcept
+        {
+            return first == Inline();
+        }
+
+        T& front() noexcept
+        {
+            return first[0];
+        }
+
+        T& back() noexcept
+        {
+            return first[count - 1];
+        }
+
+        [[nodiscard]] iterator begin() noexcept
+        {
+            return first;
+        }
+
+        [[nodiscard]] iterator end() noexcept
+        {
+            return first + count;
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return first;
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return first + count;
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return first;
+        }
+
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return first + count;
+        }
+
+    private:
+
+        T* Inline() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        const T* Inline() const noexcept
+        {
+            return std::launder(reinterpret_cast<const T*>(storage));
+        }
+
+        void Grow(size_t required)
+        {
+            size_t newCapacity = std::max(required, reserved * 2);
+            T* buffer = std::allocator<T>().allocate(newCapacity);
+
+            std::uninitialized_move(first, first + count, buffer);
+            std::destroy(first, first + count);
+
+            Release();
+
+            first = buffer;
+            reserved = newCapacity;
+        }
+
+        void Release() noexcept
+        {
+            if (!IsInline())
+                std::allocator<T>().deallocate(first, reserved);
+
+            first = Inline();
+            reserved = N;
+        }
+
+        void MoveFrom(SmallVector&& other)
+        {
+            if (other.IsInline())
+            {
+                std::uninitialized_move(other.first, other.first + other.count, first);
+                count = other.count;
+
+                other.clear();
+
+                return;
+            }
+
+            first = other.first;
+            count = other.count;
+            reserved = other.reserved;
+
+            other.first = other.Inline();
+            other.count = 0;
+            other.reserved = N;
+        }
+
+        alignas(T) std::byte storage[sizeof(T) * N];
+
+        T* first = Inline();
+        size_t count = 0;
+        size_t reserved = N;
+
+    };
+}
\ No newline at end of file
@@ -37,9 +37,9 @@ namespace Invasion::Util::XXML
 
     public:
 
-        MutableArray<Token> Tokenize()
+        LocalArray<Token> Tokenize()
         {
-            MutableArray<Token> tokens;
+            LocalArray<Token> tokens;
 
             while (!IsAtEnd())
             {
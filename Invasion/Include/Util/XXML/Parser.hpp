@@ -41,8 +41,8 @@ namespace Invasion::Util::XXML
 
     public:
 
-        UnorderedMap<NarrowString, Variable> variables;
-        UnorderedMap<NarrowString, Shared<Scope>> namespaces;
+        FlatMap<Name, Variable> variables;
+        FlatMap<Name, Shared<Scope>> namespaces;
 
         bool Exists(const NarrowString& path)
         {
@@ -67,25 +67,35 @@ namespace Invasion::Util::XXML
 
     private:
         
-        MutableArray<NarrowString> SplitPath(const NarrowString& path)
+        LocalArray<Name> SplitPath(const NarrowString& path)
         {
-            MutableArray<NarrowString> components;
+            LocalArray<Name> components;
 
             size_t start = 0;
             size_t end = 0;
 
             while ((end = path.find('.', start)) != NarrowString::NullPosition)
             {
-                components += path.SubString<char>(start, end - start);
+                Name component = Name::Find(path.View().substr(start, end - start));
+
+                if (component.IsEmpty())
+                    return LocalArray<Name>();
+
+                components += component;
                 start = end + 1;
             }
 
-            components += path.SubString<char>(start);
+            Name component = Name::Find(path.View().substr(start));
+
+            if (component.IsEmpty())
+                return LocalArray<Name>();
+
+            components += component;
 
             return components;
         }
 
-        bool Exists(const MutableArray<NarrowString>& components, size_t index = 0)
+        bool Exists(const LocalArray<Name>& components, size_t index = 0)
         {
             if (index >= components.Length())
                 return false;
@@ -118,7 +128,7 @@ namespace Invasion::Util::XXML
             return false;
         }
 
-        Shared<Value> GetValue(const MutableArray<NarrowString>& components, size_t index = 0)
+        Shared<Value> GetValue(const LocalArray<Name>& components, size_t index = 0)
         {
             if (index >= components.Length())
                 return nullptr;
@@ -202,7 +212,7 @@ namespace Invasion::Util::XXML
             return rootScope;
         }
 
-        static Shared<Parser> Create(const MutableArray<Token>& tokens)
+        static Shared<Parser> Create(const LocalArray<Token>& tokens)
         {
             Shared<Parser> result(new Parser);
 
@@ -215,7 +225,7 @@ namespace Invasion::Util::XXML
 
         Parser() = default;
 
-        MutableArray<Token> tokens;
+        LocalArray<Token> tokens;
         size_t current = 0;
 
         Token& Peek() 
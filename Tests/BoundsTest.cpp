@@ -0,0 +1,265 @@
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "Test.hpp"
+#include "Math/Frustum.hpp"
+#include "Math/Ray.hpp"
+
+using namespace Invasion::Math;
+
+namespace
+{
+	using Float3 = Vector<float, 3>;
+	using Matrix4 = Matrix<float, 4, 4>;
+
+	constexpr double Tolerance = 1e-5;
+
+	void CheckVector(const Float3& actual, const Float3& expected)
+	{
+		for (size_t i = 0; i < 3; ++i)
+			CHECK_NEAR(actual[i], expected[i], Tolerance);
+	}
+
+	AABB UnitBox()
+	{
+		return { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+	}
+
+	Frustum MakeFrustum()
+	{
+		Matrix4 view = Matrix4::LookAt({ 0.0f, 0.0f, -10.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+		Matrix4 projection = Matrix4::Projection(std::numbers::pi_v<float> / 2.0f, 1.0f, 1.0f, 100.0f);
+
+		return Frustum::FromMatrix(view * projection);
+	}
+
+	float Margin(const Frustum& frustum, const AABB& box)
+	{
+		float margin = std::numeric_limits<float>::max();
+
+		for (size_t i = 0; i < 6; ++i)
+		{
+			const Plane& plane = frustum.GetPlane(i);
+
+			margin = std::min(margin, std::abs(plane.DistanceTo(box.GetCenter()) + Float3::Dot(plane.GetNormal().Abs(), box.GetExtents())));
+		}
+
+		return margin;
+	}
+}
+
+INVASION_TEST(AABBContainsAndIntersects)
+{
+	AABB box = UnitBox();
+
+	CHECK(box.Contains(Float3{ 0.5f, -0.5f, 1.0f }));
+	CHECK(!box.Contains(Float3{ 1.5f, 0.0f, 0.0f }));
+	CHECK(box.Contains(AABB({ -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f })));
+	CHECK(!box.Contains(AABB({ 0.5f, 0.5f, 0.5f }, { 1.5f, 1.5f, 1.5f })));
+	CHECK(box.Intersects(AABB({ 0.5f, 0.5f, 0.5f }, { 1.5f, 1.5f, 1.5f })));
+	CHECK(!box.Intersects(AABB({ 1.5f, 0.0f, 0.0f }, { 2.5f, 1.0f, 1.0f })));
+	CHECK(AABB().IsEmpty());
+	CHECK(!box.IsEmpty());
+}
+
+INVASION_TEST(AABBMergeAndFromPoints)
+{
+	AABB merged = AABB::Merge(UnitBox(), AABB({ 2.0f, 0.0f, -3.0f }, { 4.0f, 0.5f, -2.0f }));
+
+	CheckVector(merged.GetMin(), { -1.0f, -1.0f, -3.0f });
+	CheckVector(merged.GetMax(), { 4.0f, 1.0f, 1.0f });
+
+	std::array<Float3, 4> points = { Float3{ 1.0f, 2.0f, 3.0f }, Float3{ -1.0f, 0.0f, 5.0f }, Float3{ 0.0f, -4.0f, 4.0f }, Float3{ 2.0f, 1.0f, -1.0f } };
+
+	AABB bounds = AABB::FromPoints(points.data(), points.size());
+
+	CheckVector(bounds.GetMin(), { -1.0f, -4.0f, -1.0f });
+	CheckVector(bounds.GetMax(), { 2.0f, 2.0f, 5.0f });
+
+	for (const Float3& point : points)
+		CHECK(bounds.Contains(point));
+}
+
+INVASION_TEST(AABBTransformBoundsRotatedCorners)
+{
+	Matrix4 matrix = Matrix4::EulerRotation({ 0.0f, 45.0f, 0.0f }) * Matrix4::Translation({ 10.0f, 0.0f, 0.0f });
+
+	AABB box = UnitBox().Transform(matrix);
+
+	CheckVector(box.GetCenter(), { 10.0f, 0.0f, 0.0f });
+	CheckVector(box.GetExtents(), { std::numbers::sqrt2_v<float>, 1.0f, std::numbers::sqrt2_v<float> });
+
+	for (const Float3& corner : UnitBox().GetCorners())
+		CHECK(box.Contains(matrix.TransformPoint(corner) * 0.9999f + box.GetCenter() * 0.0001f));
+}
+
+INVASION_TEST(OBBRoundTripsThroughAABB)
+{
+	AABB box({ 1.0f, 2.0f, 3.0f }, { 2.0f, 4.0f, 7.0f });
+	AABB roundTrip = OBB::FromAABB(box).ToAABB();
+
+	CheckVector(roundTrip.GetMin(), box.GetMin());
+	CheckVector(roundTrip.GetMax(), box.GetMax());
+}
+
+INVASION_TEST(OBBContainsAndSeparatingAxes)
+{
+	OBB rotated({ 0.0f, 0.0f, 0.0f }, { 2.0f, 0.25f, 0.25f }, Quaternion<float>::AxisAngle({ 0.0f, 0.0f, 1.0f }, 45.0f));
+
+	CHECK(rotated.Contains(Float3{ 1.0f, 1.0f, 0.0f }));
+	CHECK(!rotated.Contains(Float3{ 1.0f, -1.0f, 0.0f }));
+
+	CHECK(rotated.Intersects(AABB({ 0.9f, 0.9f, -0.1f }, { 1.1f, 1.1f, 0.1f })));
+	CHECK(!rotated.Intersects(AABB({ 0.9f, -1.1f, -0.1f }, { 1.1f, -0.9f, 0.1f })));
+
+	OBB crossed({ 0.0f, 0.0f, 0.0f }, { 2.0f, 0.25f, 0.25f }, Quaternion<float>::AxisAngle({ 0.0f, 0.0f, 1.0f }, -45.0f));
+
+	CHECK(rotated.Intersects(crossed));
+
+	OBB shifted({ 0.0f, 0.0f, 1.0f }, { 2.0f, 0.25f, 0.25f }, Quaternion<float>::AxisAngle({ 0.0f, 0.0f, 1.0f }, -45.0f));
+
+	CHECK(!rotated.Intersects(shifted));
+}
+
+INVASION_TEST(OBBTransformScalesExtents)
+{
+	OBB box = OBB::FromAABB(UnitBox()).Transform(Matrix4::Scale({ 2.0f, 3.0f, 4.0f }) * Matrix4::Translation({ 1.0f, 0.0f, 0.0f }));
+
+	CheckVector(box.GetCenter(), { 1.0f, 0.0f, 0.0f });
+	CheckVector(box.GetExtents(), { 2.0f, 3.0f, 4.0f });
+	CheckVector(box.GetAxis(1), { 0.0f, 1.0f, 0.0f });
+}
+
+INVASION_TEST(RayIntersectsAABBSlabs)
+{
+	float distance = -1.0f;
+
+	CHECK(Ray({ -5.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).Intersects(UnitBox(), distance));
+	CHECK_NEAR(distance, 4.0f, Tolerance);
+
+	CHECK(Ray({ -5.0f, -5.0f, 0.0f }, { 1.0f, 1.0f, 0.0f }).Intersects(UnitBox(), distance));
+	CHECK_NEAR(distance, 4.0f * std::numbers::sqrt2_v<float>, Tolerance);
+
+	CHECK(Ray({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }).Intersects(UnitBox(), distance));
+	CHECK_NEAR(distance, 0.0f, Tolerance);
+
+	CHECK(!Ray({ -5.0f, 2.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).Intersects(UnitBox(), distance));
+	CHECK(!Ray({ 5.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).Intersects(UnitBox(), distance));
+}
+
+INVASION_TEST(RayIntersectsOBBSphereAndPlane)
+{
+	float distance = -1.0f;
+
+	OBB rotated({ 5.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, Quaternion<float>::AxisAngle({ 0.0f, 1.0f, 0.0f }, 45.0f));
+
+	CHECK(Ray({ 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).Intersects(rotated, distance));
+	CHECK_NEAR(distance, 5.0f - std::numbers::sqrt2_v<float>, Tolerance);
+	CHECK(!Ray({ 0.0f, 2.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).Intersects(rotated, distance));
+
+	CHECK(Ray({ 0.0f, 0.0f, -10.0f }, { 0.0f, 0.0f, 1.0f }).Intersects(BoundingSphere({ 0.0f, 0.0f, 0.0f }, 2.0f), distance));
+	CHECK_NEAR(distance, 8.0f, Tolerance);
+	CHECK(!Ray({ 0.0f, 3.0f, -10.0f }, { 0.0f, 0.0f, 1.0f }).Intersects(BoundingSphere({ 0.0f, 0.0f, 0.0f }, 2.0f), distance));
+
+	CHECK(Ray({ 0.0f, 10.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }).Intersects(Plane({ 0.0f, 1.0f, 0.0f }, -2.0f), distance));
+	CHECK_NEAR(distance, 8.0f, Tolerance);
+	CHECK(!Ray({ 0.0f, 10.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).Intersects(Plane({ 0.0f, 1.0f, 0.0f }, -2.0f), distance));
+}
+
+INVASION_TEST(RayTransformKeepsDirectionNormalized)
+{
+	Ray ray = Ray({ 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }).Transform(Matrix4::Scale({ 3.0f, 3.0f, 3.0f }) * Matrix4::Translation({ 0.0f, 1.0f, 0.0f }));
+
+	CheckVector(ray.GetOrigin(), { 3.0f, 1.0f, 0.0f });
+	CheckVector(ray.GetDirection(), { 0.0f, 0.0f, 1.0f });
+}
+
+INVASION_TEST(FrustumClassifiesPointsSpheresAndBoxes)
+{
+	Frustum frustum = MakeFrustum();
+
+	CHECK(frustum.Contains(Float3{ 0.0f, 0.0f, 0.0f }));
+	CHECK(!frustum.Contains(Float3{ 0.0f, 0.0f, -20.0f }));
+	CHECK(!frustum.Contains(Float3{ 50.0f, 0.0f, 0.0f }));
+	CHECK(!frustum.Contains(Float3{ 0.0f, 0.0f, 100.0f }));
+
+	CHECK(frustum.Intersects(BoundingSphere({ 12.0f, 0.0f, 0.0f }, 2.0f)));
+	CHECK(!frustum.Intersects(BoundingSphere({ 15.0f, 0.0f, 0.0f }, 2.0f)));
+
+	CHECK(frustum.Intersects(AABB({ 9.0f, -1.0f, -1.0f }, { 11.0f, 1.0f, 1.0f })));
+	CHECK(!frustum.Intersects(AABB({ 0.0f, 0.0f, -30.0f }, { 1.0f, 1.0f, -20.0f })));
+
+	CHECK(frustum.Intersects(OBB::FromAABB(UnitBox())));
+	CHECK(!frustum.Intersects(OBB({ 0.0f, 30.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, Quaternion<float>::Identity())));
+}
+
+INVASION_TEST(FrustumBatchOfEightMatchesExpected)
+{
+	Frustum frustum = MakeFrustum();
+
+	std::array<AABB, 8> boxes =
+	{
+		UnitBox(),
+		AABB({ 0.0f, 0.0f, -30.0f }, { 1.0f, 1.0f, -20.0f }),
+		AABB({ 9.0f, -1.0f, -1.0f }, { 11.0f, 1.0f, 1.0f }),
+		AABB({ 30.0f, -1.0f, -1.0f }, { 31.0f, 1.0f, 1.0f }),
+		AABB({ -1.0f, 8.0f, 0.0f }, { 1.0f, 12.0f, 1.0f }),
+		AABB({ -1.0f, -40.0f, 0.0f }, { 1.0f, -30.0f, 1.0f }),
+		AABB({ -1.0f, -1.0f, 80.0f }, { 1.0f, 1.0f, 95.0f }),
+		AABB({ -1.0f, -1.0f, 95.0f }, { 1.0f, 1.0f, 120.0f })
+	};
+
+	constexpr std::array<bool, 8> expected = { true, false, true, false, true, false, true, false };
+
+	std::array<bool, 8> results{};
+
+	frustum.Intersects(boxes.data(), results.data(), boxes.size());
+
+	for (size_t i = 0; i < boxes.size(); ++i)
+	{
+		CHECK(results[i] == expected[i]);
+		CHECK(results[i] == frustum.Intersects(boxes[i]));
+	}
+}
+
+INVASION_TEST(FrustumBatchMatchesScalar)
+{
+	Frustum frustum = MakeFrustum();
+
+	std::mt19937 random(42);
+	std::uniform_real_distribution<float> position(-60.0f, 120.0f);
+	std::uniform_real_distribution<float> size(0.1f, 8.0f);
+
+	std::vector<AABB> boxes;
+
+	for (size_t i = 0; i < 4099; ++i)
+	{
+		Float3 center = { position(random), position(random), position(random) };
+
+		boxes.push_back(AABB::FromCenterExtents(center, { size(random), size(random), size(random) }));
+	}
+
+	std::vector<char> results(boxes.size());
+
+	frustum.Intersects(boxes.data(), reinterpret_cast<bool*>(results.data()), boxes.size());
+
+	size_t inside = 0;
+	size_t mismatches = 0;
+
+	for (size_t i = 0; i < boxes.size(); ++i)
+	{
+		bool scalar = frustum.Intersects(boxes[i]);
+
+		inside += scalar ? 1 : 0;
+
+		if (static_cast<bool>(results[i]) != scalar && Margin(frustum, boxes[i]) > 1e-4f)
+			++mismatches;
+	}
+
+	CHECK(mismatches == 0);
+	CHECK(inside > 0);
+	CHECK(inside < boxes.size());
+}
\ No newline at end of file
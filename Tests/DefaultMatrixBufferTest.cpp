@@ -0,0 +1,69 @@
+#include <cstring>
+
+#include "Test.hpp"
+#include "Render/DefaultMatrixBuffer.hpp"
+
+using namespace Invasion::Math;
+using namespace Invasion::Render;
+
+namespace
+{
+	using Float4x4 = Matrix<float, 4, 4>;
+
+	Float4x4 Sequence(float start)
+	{
+		Float4x4 result;
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+				result(row, column) = start + static_cast<float>(row * 4 + column);
+		}
+
+		return result;
+	}
+}
+
+INVASION_TEST(LayoutMatchesMatrixBufferRegisters)
+{
+	CHECK(sizeof(DefaultMatrixBuffer) == 256);
+	CHECK(alignof(DefaultMatrixBuffer) == 16);
+
+	CHECK(offsetof(DefaultMatrixBuffer, projectionMatrix) == 0);
+	CHECK(offsetof(DefaultMatrixBuffer, viewMatrix) == 64);
+	CHECK(offsetof(DefaultMatrixBuffer, modelMatrix) == 128);
+	CHECK(offsetof(DefaultMatrixBuffer, normalMatrix) == 192);
+}
+
+INVASION_TEST(MatricesAreUploadedRowMajor)
+{
+	DefaultMatrixBuffer buffer
+	{
+		Sequence(0.0f),
+		Sequence(16.0f),
+		Sequence(32.0f),
+		Sequence(48.0f)
+	};
+
+	float floats[64];
+
+	std::memcpy(floats, &buffer, sizeof(floats));
+
+	for (size_t i = 0; i < 64; ++i)
+		CHECK(floats[i] == static_cast<float>(i));
+}
+
+INVASION_TEST(NormalMatrixFieldHoldsInverseTranspose)
+{
+	Float4x4 model = Float4x4::Scale({ 2.0f, 4.0f, 0.5f }) * Float4x4::Translation({ 1.0f, 2.0f, 3.0f });
+
+	DefaultMatrixBuffer buffer{ Float4x4::Identity(), Float4x4::Identity(), model, model.NormalMatrix() };
+
+	float floats[16];
+
+	std::memcpy(floats, reinterpret_cast<const std::byte*>(&buffer) + offsetof(DefaultMatrixBuffer, normalMatrix), sizeof(floats));
+
+	CHECK(floats[0] == 0.5f);
+	CHECK(floats[5] == 0.25f);
+	CHECK(floats[10] == 2.0f);
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Test.hpp"
+#include "Util/Types/FlatHashMap.hpp"
+
+using namespace Invasion::Util::Types;
+
+namespace
+{
+	struct CollidingHash
+	{
+		size_t operator()(uint32_t key) const noexcept
+		{
+			return key % 3;
+		}
+	};
+
+	struct Fragile
+	{
+		static inline int copiesLeft = -1;
+
+		int value = 0;
+
+		Fragile() = default;
+
+		explicit Fragile(int value) : value(value) { }
+
+		Fragile(const Fragile& other) : value(other.value)
+		{
+			if (copiesLeft == 0)
+				throw std::runtime_error("copy failed");
+
+			if (copiesLeft > 0)
+				--copiesLeft;
+		}
+
+		Fragile(Fragile&& other) : value(other.value) { }
+
+		Fragile& operator=(const Fragile&) = default;
+	};
+}
+
+INVASION_TEST(InsertFindErase)
+{
+	FlatHashMap<std::string, int> map;
+
+	CHECK(map.empty());
+	CHECK(map.find("missing") == map.end());
+
+	CHECK(map.insert({ "one", 1 }).second);
+	CHECK(map.try_emplace("two", 2).second);
+	map["three"] = 3;
+
+	CHECK(!map.insert({ "one", 10 }).second);
+	CHECK(map.at("one") == 1);
+	CHECK(map.size() == 3);
+
+	CHECK(map.find("two")->second == 2);
+	CHECK(map.contains("three"));
+
+	CHECK(map.erase("two") == 1);
+	CHECK(map.erase("two") == 0);
+	CHECK(!map.contains("two"));
+	CHECK(map.size() == 2);
+
+	bool threw = false;
+
+	try
+	{
+		(void)map.at("two");
+	}
+	catch (const std::out_of_range&)
+	{
+		threw = true;
+	}
+
+	CHECK(threw);
+}
+
+INVASION_TEST(TombstonesAreReused)
+{
+	FlatHashMap<uint32_t, uint32_t> map;
+
+	map.reserve(8);
+
+	const size_t capacity = map.bucket_count();
+
+	for (uint32_t key = 0; key < 100000; ++key)
+	{
+		map[key] = key;
+
+		if (key >= 8)
+			CHECK(map.erase(key - 8) == 1);
+	}
+
+	CHECK(map.size() == 8);
+	CHECK(map.bucket_count() == capacity);
+
+	for (uint32_t key = 100000 - 8; key < 100000; ++key)
+		CHECK(map.at(key) == key);
+}
+
+INVASION_TEST(GrowthKeepsEveryEntry)
+{
+	FlatHashMap<uint64_t, uint64_t> map;
+
+	size_t rehashes = 0;
+	size_t capacity = map.bucket_count();
+
+	for (uint64_t key = 0; key < 50000; ++key)
+	{
+		map.try_emplace(key * 7919, key);
+
+		if (map.bucket_count() != capacity)
+		{
+			++rehashes;
+			capacity = map.bucket_count();
+		}
+	}
+
+	CHECK(rehashes > 5);
+	CHECK(map.size() == 50000);
+
+	for (uint64_t key = 0; key < 50000; ++key)
+		CHECK(map.at(key * 7919) == key);
+
+	CHECK(!map.contains(1));
+}
+
+INVASION_TEST(IterationSkipsErasedEntries)
+{
+	FlatHashMap<uint32_t, uint32_t> map;
+
+	for (uint32_t key = 0; key < 1000; ++key)
+		map[key] = key * 2;
+
+	for (uint32_t key = 0; key < 1000; key += 2)
+		map.erase(key);
+
+	for (auto it = map.begin(); it != map.end();)
+	{
+		if (it->first % 3 == 0)
+			it = map.erase(it);
+		else
+			++it;
+	}
+
+	std::vector<int> seen(1000, 0);
+
+	for (const auto& [key, value] : map)
+	{
+		CHECK(value == key * 2);
+		++seen[key];
+	}
+
+	size_t visited = 0;
+
+	for (uint32_t key = 0; key < 1000; ++key)
+	{
+		bool kept = key % 2 == 1 && key % 3 != 0;
+
+		CHECK(seen[key] == (kept ? 1 : 0));
+		visited += seen[key];
+	}
+
+	CHECK(visited == map.size());
+}
+
+INVASION_TEST(CollidingKeysStayDistinct)
+{
+	FlatHashMap<uint32_t, uint32_t, CollidingHash> map;
+
+	for (uint32_t key = 0; key < 2000; ++key)
+		map[key] = key + 1;
+
+	for (uint32_t key = 0; key < 2000; key += 5)
+		map.erase(key);
+
+	for (uint32_t key = 0; key < 2000; ++key)
+	{
+		if (key % 5 == 0)
+			CHECK(!map.contains(key));
+		else
+			CHECK(map.at(key) == key + 1);
+	}
+
+	for (uint32_t key = 0; key < 2000; key += 5)
+		map[key] = key;
+
+	CHECK(map.size() == 2000);
+	CHECK(map.at(1995) == 1995);
+}
+
+INVASION_TEST(ThrowingRehashLeavesMapUnchanged)
+{
+	FlatHashMap<int, Fragile> map;
+
+	bool threw = false;
+
+	for (int key = 0; key < 1000 && !threw; ++key)
+	{
+		FlatHashMap<int, Fragile> before = map;
+
+		Fragile::copiesLeft = 3;
+
+		try
+		{
+			map.try_emplace(key, key);
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+
+			CHECK(!map.contains(key));
+			CHECK(map.size() == before.size());
+			CHECK(map.bucket_count() == before.bucket_count());
+
+			for (const auto& [k, value] : before)
+				CHECK(map.at(k).value == value.value);
+		}
+
+		Fragile::copiesLeft = -1;
+	}
+
+	CHECK(threw);
+}
\ No newline at end of file
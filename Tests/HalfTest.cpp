@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "Test.hpp"
+#include "Math/Half.hpp"
+#include "Math/Normalized.hpp"
+
+using namespace Invasion::Math;
+
+namespace
+{
+	constexpr uint16_t PositiveInfinity = 0x7C00;
+
+	bool IsNaN(uint16_t bits)
+	{
+		return (bits & 0x7C00u) == 0x7C00u && (bits & 0x03FFu) != 0;
+	}
+
+	uint16_t ReferenceBits(float value)
+	{
+		uint16_t sign = std::signbit(value) ? 0x8000u : 0u;
+		double magnitude = std::abs(static_cast<double>(value));
+
+		if (std::isnan(value))
+			return 0x7E00u | sign;
+
+		if (magnitude >= 65520.0)
+			return PositiveInfinity | sign;
+
+		uint16_t lower = 0;
+		uint16_t upper = 0x7BFF;
+
+		while (lower < upper)
+		{
+			uint16_t middle = static_cast<uint16_t>((lower + upper + 1) / 2);
+
+			if (static_cast<double>(static_cast<float>(Half::FromBits(middle))) <= magnitude)
+				lower = middle;
+			else
+				upper = static_cast<uint16_t>(middle - 1);
+		}
+
+		uint16_t result = lower;
+
+		if (lower < 0x7BFF)
+		{
+			double below = magnitude - static_cast<float>(Half::FromBits(lower));
+			double above = static_cast<float>(Half::FromBits(static_cast<uint16_t>(lower + 1))) - magnitude;
+
+			if (above < below || (above == below && (lower & 1u)))
+				result = static_cast<uint16_t>(lower + 1);
+		}
+
+		return static_cast<uint16_t>(result | sign);
+	}
+
+	std::vector<float> SampleFloats()
+	{
+		std::vector<float> values;
+
+		for (uint64_t bits = 0; bits <= 0xFFFFFFFFull; bits += 4093)
+			values.push_back(std::bit_cast<float>(static_cast<uint32_t>(bits)));
+
+		for (uint32_t half = 0; half < 0x7C00u; ++half)
+		{
+			float value = static_cast<float>(Half::FromBits(static_cast<uint16_t>(half)));
+			float next = static_cast<float>(Half::FromBits(static_cast<uint16_t>(half + 1)));
+			float tie = static_cast<float>((static_cast<double>(value) + next) / 2.0);
+
+			values.insert(values.end(), { value, -value, tie, -tie, std::nextafter(tie, 0.0f), std::nextafter(tie, 1e9f) });
+		}
+
+		values.insert(values.end(), { 65504.0f, 65519.99f, 65520.0f, 1e9f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), 5.9604645e-8f, 2.9802322e-8f, 2.9802326e-8f });
+
+		return values;
+	}
+}
+
+INVASION_TEST(HalfEncodesKnownValues)
+{
+	CHECK(Half(1.0f).GetBits() == 0x3C00);
+	CHECK(Half(-2.0f).GetBits() == 0xC000);
+	CHECK(Half(65504.0f).GetBits() == 0x7BFF);
+	CHECK(Half(65520.0f).GetBits() == PositiveInfinity);
+	CHECK(Half(5.9604645e-8f).GetBits() == 0x0001);
+	CHECK(Half(2.9802322e-8f).GetBits() == 0x0000);
+	CHECK(Half(std::numeric_limits<float>::infinity()).GetBits() == PositiveInfinity);
+	CHECK(IsNaN(Half(std::numeric_limits<float>::quiet_NaN()).GetBits()));
+	CHECK(static_cast<float>(Half::FromBits(0x3555)) == 0.333251953125f);
+}
+
+INVASION_TEST(HalfRoundTripsEveryBitPattern)
+{
+	std::vector<Half> halves(0x10000);
+	std::vector<float> floats(halves.size());
+	std::vector<Half> back(halves.size());
+
+	for (size_t i = 0; i < halves.size(); ++i)
+		halves[i] = Half::FromBits(static_cast<uint16_t>(i));
+
+	Half::Convert(halves.data(), floats.data(), halves.size());
+	Half::Convert(floats.data(), back.data(), floats.size());
+
+	size_t mismatches = 0;
+
+	for (size_t i = 0; i < halves.size(); ++i)
+	{
+		uint16_t bits = static_cast<uint16_t>(i);
+		float scalar = static_cast<float>(halves[i]);
+
+		if (IsNaN(bits))
+		{
+			mismatches += std::isnan(floats[i]) && std::isnan(scalar) && IsNaN(back[i].GetBits()) && IsNaN(Half(scalar).GetBits()) ? 0 : 1;
+
+			continue;
+		}
+
+		mismatches += std::bit_cast<uint32_t>(floats[i]) == std::bit_cast<uint32_t>(scalar) ? 0 : 1;
+		mismatches += back[i].GetBits() == bits && Half(scalar).GetBits() == bits ? 0 : 1;
+	}
+
+	CHECK(mismatches == 0);
+}
+
+INVASION_TEST(HalfRoundsToNearestEven)
+{
+	std::vector<float> values = SampleFloats();
+	std::vector<Half> bulk(values.size());
+
+	Half::Convert(values.data(), bulk.data(), values.size());
+
+	size_t scalarMismatches = 0;
+	size_t bulkMismatches = 0;
+
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		uint16_t expected = ReferenceBits(values[i]);
+		uint16_t scalar = Half(values[i]).GetBits();
+
+		if (IsNaN(expected))
+		{
+			scalarMismatches += IsNaN(scalar) ? 0 : 1;
+			bulkMismatches += IsNaN(bulk[i].GetBits()) ? 0 : 1;
+
+			continue;
+		}
+
+		scalarMismatches += scalar == expected ? 0 : 1;
+		bulkMismatches += bulk[i].GetBits() == expected ? 0 : 1;
+	}
+
+	CHECK(scalarMismatches == 0);
+	CHECK(bulkMismatches == 0);
+}
+
+INVASION_TEST(HalfRelativeErrorIsWithinHalfUlp)
+{
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> exponent(-14.0f, 15.9f);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < 100000; ++i)
+	{
+		float value = std::exp2(exponent(random));
+
+		worst = std::max(worst, std::abs(static_cast<double>(static_cast<float>(Half(value))) - value) / value);
+	}
+
+	CHECK(worst <= std::ldexp(1.0, -11));
+}
+
+INVASION_TEST(SNormRoundTripsWithinHalfStep)
+{
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+
+	std::vector<Vector<float, 2>> source(1027);
+
+	for (auto& value : source)
+		value = { component(random), component(random) };
+
+	source[0] = { -1.0f, 1.0f };
+	source[1] = { 0.0f, -0.0f };
+	source[2] = { -3.0f, 2.0f };
+
+	std::vector<SNorm16x2> packed(source.size());
+	std::vector<Vector<float, 2>> unpacked(source.size());
+
+	SNorm16x2::Convert(source.data(), packed.data(), source.size());
+	SNorm16x2::Convert(packed.data(), unpacked.data(), packed.size());
+
+	double worst = 0.0;
+	size_t mismatches = 0;
+
+	for (size_t i = 0; i < source.size(); ++i)
+	{
+		SNorm16x2 scalar(source[i]);
+
+		mismatches += scalar.GetX() == packed[i].GetX() && scalar.GetY() == packed[i].GetY() ? 0 : 1;
+		mismatches += scalar.ToVector() == unpacked[i] ? 0 : 1;
+
+		for (size_t j = 0; j < 2; ++j)
+			worst = std::max(worst, static_cast<double>(std::abs(unpacked[i][j] - std::clamp(source[i][j], -1.0f, 1.0f))));
+	}
+
+	CHECK(mismatches == 0);
+	CHECK(worst <= 0.5 / 32767.0 + 1e-7);
+	CHECK(unpacked[0] == (Vector<float, 2>{ -1.0f, 1.0f }));
+	CHECK(unpacked[2] == (Vector<float, 2>{ -1.0f, 1.0f }));
+}
+
+INVASION_TEST(UNormRoundTripsEveryByte)
+{
+	std::vector<Vector<float, 4>> source(256);
+
+	for (size_t i = 0; i < source.size(); ++i)
+		source[i] = { i / 255.0f, (255 - i) / 255.0f, i / 255.0f + 0.4f / 255.0f, i / 255.0f - 0.4f / 255.0f };
+
+	std::vector<UNorm8x4> packed(source.size());
+	std::vector<Vector<float, 4>> unpacked(source.size());
+
+	UNorm8x4::Convert(source.data(), packed.data(), source.size());
+	UNorm8x4::Convert(packed.data(), unpacked.data(), packed.size());
+
+	size_t mismatches = 0;
+
+	for (size_t i = 0; i < source.size(); ++i)
+	{
+		UNorm8x4 scalar(source[i]);
+
+		uint32_t expected = static_cast<uint32_t>(i) | static_cast<uint32_t>(255 - i) << 8 | static_cast<uint32_t>(i) << 16 | static_cast<uint32_t>(i) << 24;
+
+		mismatches += scalar.GetBits() == expected ? 0 : 1;
+		mismatches += packed[i].GetBits() == expected ? 0 : 1;
+		mismatches += unpacked[i] == scalar.ToVector() ? 0 : 1;
+		mismatches += std::abs(unpacked[i][0] - source[i][0]) <= 1e-7f ? 0 : 1;
+	}
+
+	CHECK(mismatches == 0);
+}
+
+INVASION_TEST(OctahedralNormalRoundTripsWithinAngle)
+{
+	std::mt19937 random(13);
+	std::normal_distribution<float> component;
+
+	std::vector<Vector<float, 3>> normals = { { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f } };
+
+	for (size_t i = 0; i < 100000; ++i)
+		normals.push_back(Vector<float, 3>{ component(random), component(random), component(random) }.Normalize());
+
+	double worst = 0.0;
+
+	for (const auto& normal : normals)
+	{
+		Vector<float, 3> decoded = OctahedralNormal(normal).ToVector();
+
+		Vector<double, 3> a = { normal[0], normal[1], normal[2] };
+		Vector<double, 3> b = { decoded[0], decoded[1], decoded[2] };
+
+		worst = std::max(worst, std::atan2(Vector<double, 3>::Cross(a, b).Length(), Vector<double, 3>::Dot(a, b)));
+	}
+
+	for (size_t i = 0; i < 6; ++i)
+		CHECK(OctahedralNormal(normals[i]).ToVector() == normals[i]);
+
+	CHECK(worst <= 1e-4);
+}
\ No newline at end of file
@@ -0,0 +1,395 @@
+#include <array>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "Test.hpp"
+#include "Math/Matrix.hpp"
+
+using namespace Invasion::Math;
+
+namespace
+{
+	using Matrix4 = Matrix<float, 4, 4>;
+	using Reference = std::array<std::array<double, 4>, 4>;
+
+	float* Pointer(Matrix4& matrix)
+	{
+		return &matrix(0, 0);
+	}
+
+	Reference ToReference(const Matrix4& matrix)
+	{
+		Reference result{};
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			for (size_t j = 0; j < 4; ++j)
+				result[i][j] = matrix[i][j];
+		}
+
+		return result;
+	}
+
+	Matrix4 FromReference(const Reference& reference)
+	{
+		Matrix4 result;
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			for (size_t j = 0; j < 4; ++j)
+				result[i][j] = static_cast<float>(reference[i][j]);
+		}
+
+		return result;
+	}
+
+	Reference Multiply(const Reference& a, const Reference& b)
+	{
+		Reference result{};
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			for (size_t j = 0; j < 4; ++j)
+			{
+				for (size_t k = 0; k < 4; ++k)
+					result[i][j] += a[i][k] * b[k][j];
+			}
+		}
+
+		return result;
+	}
+
+	Reference Invert(Reference source)
+	{
+		Reference result{};
+
+		for (size_t i = 0; i < 4; ++i)
+			result[i][i] = 1.0;
+
+		for (size_t column = 0; column < 4; ++column)
+		{
+			size_t pivot = column;
+
+			for (size_t row = column + 1; row < 4; ++row)
+			{
+				if (std::abs(source[row][column]) > std::abs(source[pivot][column]))
+					pivot = row;
+			}
+
+			std::swap(source[pivot], source[column]);
+			std::swap(result[pivot], result[column]);
+
+			double divisor = source[column][column];
+
+			for (size_t j = 0; j < 4; ++j)
+			{
+				source[column][j] /= divisor;
+				result[column][j] /= divisor;
+			}
+
+			for (size_t row = 0; row < 4; ++row)
+			{
+				if (row == column)
+					continue;
+
+				double factor = source[row][column];
+
+				for (size_t j = 0; j < 4; ++j)
+				{
+					source[row][j] -= factor * source[column][j];
+					result[row][j] -= factor * result[column][j];
+				}
+			}
+		}
+
+		return result;
+	}
+
+	double Error(const Matrix4& actual, const Reference& expected)
+	{
+		double difference = 0.0;
+		double magnitude = 0.0;
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			for (size_t j = 0; j < 4; ++j)
+			{
+				difference = std::max(difference, std::abs(actual[i][j] - expected[i][j]));
+				magnitude = std::max(magnitude, std::abs(expected[i][j]));
+			}
+		}
+
+		return difference / std::max(magnitude, 1.0);
+	}
+
+	Matrix4 RandomMatrix(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		Matrix4 result;
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			for (size_t j = 0; j < 4; ++j)
+				result[i][j] = distribution(random) + (i == j ? 4.0f : 0.0f);
+		}
+
+		return result;
+	}
+
+	Matrix4 RandomAffine(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+		std::uniform_real_distribution<float> scale(0.25f, 4.0f);
+		std::uniform_real_distribution<float> translation(-100.0f, 100.0f);
+
+		Matrix4 result = Matrix4::Scale({ scale(random), scale(random), scale(random) }) * Matrix4::EulerRotation({ angle(random), angle(random), angle(random) });
+
+		result[3][0] = translation(random);
+		result[3][1] = translation(random);
+		result[3][2] = translation(random);
+
+		return result;
+	}
+
+	constexpr size_t SampleCount = 10000;
+	constexpr double InverseTolerance = 1e-5;
+	constexpr double RoundTripTolerance = 1e-4;
+}
+
+INVASION_TEST(MultiplyMatchesReference)
+{
+	std::mt19937 random(12);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		Matrix4 a = RandomMatrix(random);
+		Matrix4 b = RandomAffine(random);
+
+		Matrix4 kernel;
+
+		Simd::MultiplyMatrix(Pointer(a), Pointer(b), Pointer(kernel));
+
+		Reference expected = Multiply(ToReference(a), ToReference(b));
+
+		worst = std::max(worst, Error(kernel, expected));
+		worst = std::max(worst, Error(a * b, expected));
+	}
+
+	CHECK(worst <= 1e-6);
+}
+
+INVASION_TEST(TransposeIsExact)
+{
+	std::mt19937 random(7);
+
+	Matrix4 source = RandomMatrix(random);
+	Matrix4 kernel;
+
+	Simd::TransposeMatrix(Pointer(source), Pointer(kernel));
+
+	for (size_t i = 0; i < 4; ++i)
+	{
+		for (size_t j = 0; j < 4; ++j)
+		{
+			CHECK(kernel[i][j] == source[j][i]);
+			CHECK(source.Transpose()[i][j] == source[j][i]);
+		}
+	}
+}
+
+INVASION_TEST(InverseMatchesReferenceValues)
+{
+	Matrix4 rotation = { { 0.0f, 0.0f, -1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } };
+	Matrix4 affine = { { 2.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 4.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 8.0f, 0.0f }, { 1.0f, 2.0f, 3.0f, 1.0f } };
+	Matrix4 general = { { 1.0f, 2.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 3.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } };
+
+	Reference rotationInverse = { { { 0.0, 0.0, 1.0, 0.0 }, { 0.0, 1.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0, 1.0 } } };
+	Reference affineInverse = { { { 0.5, 0.0, 0.0, 0.0 }, { 0.0, 0.25, 0.0, 0.0 }, { 0.0, 0.0, 0.125, 0.0 }, { -0.5, -0.5, -0.375, 1.0 } } };
+	Reference generalInverse = { { { 1.0, -2.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0, -3.0 }, { 0.0, 0.0, 0.0, 1.0 } } };
+
+	Matrix4 kernel;
+
+	CHECK(Simd::InverseMatrix(Pointer(rotation), Pointer(kernel)) == 1.0f);
+	CHECK(Error(kernel, rotationInverse) == 0.0);
+
+	CHECK(Simd::InverseMatrix(Pointer(affine), Pointer(kernel)) == 64.0f);
+	CHECK(Error(kernel, affineInverse) == 0.0);
+
+	CHECK(Simd::InverseMatrix(Pointer(general), Pointer(kernel)) == 1.0f);
+	CHECK(Error(kernel, generalInverse) == 0.0);
+
+	CHECK(Simd::AffineInverseMatrix(Pointer(rotation), Pointer(kernel)) == 1.0f);
+	CHECK(Error(kernel, rotationInverse) == 0.0);
+
+	CHECK(Simd::AffineInverseMatrix(Pointer(affine), Pointer(kernel)) == 64.0f);
+	CHECK(Error(kernel, affineInverse) == 0.0);
+
+	CHECK(Error(affine.Inverse(), affineInverse) == 0.0);
+	CHECK(Error(affine.AffineInverse(), affineInverse) == 0.0);
+}
+
+INVASION_TEST(InverseMatchesReference)
+{
+	std::mt19937 random(3);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		Matrix4 source = i % 2 == 0 ? RandomMatrix(random) : RandomAffine(random);
+		Matrix4 kernel;
+
+		CHECK(Simd::InverseMatrix(Pointer(source), Pointer(kernel)) != 0.0f);
+
+		Reference expected = Invert(ToReference(source));
+
+		worst = std::max(worst, Error(kernel, expected));
+		worst = std::max(worst, Error(source.Inverse(), expected));
+	}
+
+	std::printf("  inverse worst relative error %.3g\n", worst);
+
+	CHECK(worst <= InverseTolerance);
+}
+
+INVASION_TEST(AffineInverseMatchesReference)
+{
+	std::mt19937 random(5);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		Matrix4 source = RandomAffine(random);
+		Matrix4 kernel;
+
+		CHECK(Simd::AffineInverseMatrix(Pointer(source), Pointer(kernel)) != 0.0f);
+
+		Reference expected = Invert(ToReference(source));
+
+		worst = std::max(worst, Error(kernel, expected));
+		worst = std::max(worst, Error(source.AffineInverse(), expected));
+	}
+
+	std::printf("  affine inverse worst relative error %.3g\n", worst);
+
+	CHECK(worst <= InverseTolerance);
+}
+
+INVASION_TEST(InverseRoundTripsToIdentity)
+{
+	std::mt19937 random(9);
+
+	Reference identity{};
+
+	for (size_t i = 0; i < 4; ++i)
+		identity[i][i] = 1.0;
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		Matrix4 source = RandomAffine(random);
+
+		worst = std::max(worst, Error(FromReference(Multiply(ToReference(source), ToReference(source.Inverse()))), identity));
+	}
+
+	std::printf("  round trip worst error %.3g\n", worst);
+
+	CHECK(worst <= RoundTripTolerance);
+}
+
+INVASION_TEST(SingularInverseReportsZeroDeterminant)
+{
+	Matrix4 singular = Matrix4::Scale({ 1.0f, 0.0f, 1.0f });
+	Matrix4 kernel;
+
+	CHECK(Simd::InverseMatrix(Pointer(singular), Pointer(kernel)) == 0.0f);
+	CHECK(Simd::AffineInverseMatrix(Pointer(singular), Pointer(kernel)) == 0.0f);
+
+	bool threw = false;
+
+	try
+	{
+		(void)singular.Inverse();
+	}
+	catch (const std::invalid_argument&)
+	{
+		threw = true;
+	}
+
+	CHECK(threw);
+}
+
+INVASION_TEST(InverseTransposeMatchesReference)
+{
+	std::mt19937 random(11);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		Matrix4 source = RandomAffine(random);
+		Matrix4 kernel;
+
+		CHECK(Simd::InverseTransposeMatrix(Pointer(source), Pointer(kernel)) != 0.0f);
+
+		Reference linear = ToReference(source);
+
+		for (size_t j = 0; j < 3; ++j)
+		{
+			linear[3][j] = 0.0;
+			linear[j][3] = 0.0;
+		}
+
+		Reference inverse = Invert(linear);
+		Reference expected{};
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+				expected[row][column] = inverse[column][row];
+		}
+
+		worst = std::max(worst, Error(kernel, expected));
+		worst = std::max(worst, Error(source.InverseTranspose(), expected));
+		worst = std::max(worst, Error(source.NormalMatrix(), expected));
+	}
+
+	std::printf("  inverse transpose worst relative error %.3g\n", worst);
+
+	CHECK(worst <= InverseTolerance);
+}
+
+INVASION_TEST(NormalMatrixFallsBackForSingularInput)
+{
+	Matrix4 flattened = Matrix4::Scale({ 1.0f, 0.0f, 1.0f });
+	Matrix4 collapsed = Matrix4::Scale({ 0.0f, 0.0f, 0.0f });
+	Matrix4 tiny = Matrix4::Scale({ 1e-20f, 1e-20f, 1e-20f });
+	Matrix4 kernel;
+
+	CHECK(Simd::InverseTransposeMatrix(Pointer(flattened), Pointer(kernel)) == 0.0f);
+
+	CHECK(flattened.NormalMatrix() == Matrix4::Identity());
+	CHECK(collapsed.NormalMatrix() == Matrix4::Identity());
+	CHECK(tiny.NormalMatrix() == Matrix4::Identity());
+
+	static_assert(noexcept(flattened.NormalMatrix()));
+
+	bool threw = false;
+
+	try
+	{
+		(void)flattened.InverseTranspose();
+	}
+	catch (const std::invalid_argument&)
+	{
+		threw = true;
+	}
+
+	CHECK(threw);
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include <thread>
+#include <vector>
+
+#include "Test.hpp"
+#include "Util/XXML/Parser.hpp"
+
+using namespace Invasion::Util;
+
+namespace
+{
+	using NameTable = Types::BasicNameTable<char>;
+
+	Shared<XXML::Scope> ParseSettings()
+	{
+		return XXML::Parser::Create(XXML::Lexer::Create(NarrowString(Invasion::Tests::ReadAsset("Invasion/EngineSettings.xxml")))->Tokenize())->Parse();
+	}
+}
+
+INVASION_TEST(FindDoesNotIntern)
+{
+	size_t count = NameTable::GetInstance().Count();
+
+	CHECK(Name::Find("NameTest.NeverInterned").IsEmpty());
+	CHECK(Name::Find("").IsEmpty());
+	CHECK(NameTable::GetInstance().Count() == count);
+}
+
+INVASION_TEST(FindReturnsInternedName)
+{
+	Name interned = "NameTest.Interned";
+
+	CHECK(Name::Find("NameTest.Interned") == interned);
+	CHECK(Name::Find(std::string("NameTest.Interned")).GetHash() == interned.GetHash());
+}
+
+INVASION_TEST(ConcurrentInternIsUnique)
+{
+	constexpr size_t NameCount = 4096;
+
+	std::vector<std::string> values;
+
+	for (size_t i = 0; i < NameCount; ++i)
+		values.push_back("NameTest.Concurrent." + std::to_string(i));
+
+	std::vector<std::vector<Name>> results(4);
+	std::vector<std::thread> threads;
+
+	for (auto& result : results)
+	{
+		threads.emplace_back([&values, &result]()
+		{
+			for (const std::string& value : values)
+				result.push_back(Name(value));
+		});
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	bool unique = true;
+
+	for (size_t i = 0; i < NameCount; ++i)
+	{
+		for (const auto& result : results)
+			unique = unique && result[i] == results[0][i] && result[i].GetView() == values[i];
+	}
+
+	CHECK(unique);
+}
+
+INVASION_TEST(PathLookupDoesNotInternMissingComponents)
+{
+	Shared<XXML::Scope> settings = ParseSettings();
+
+	CHECK(settings->Exists("Invasion_Default.WindowProperties.Title"));
+	CHECK(settings->Get<NarrowString>("Invasion_Default.WindowProperties.Title") == "Invasion");
+
+	size_t count = NameTable::GetInstance().Count();
+
+	CHECK(!settings->Exists("Invasion_Default.NameTest.Missing"));
+	CHECK(!settings->Exists("NameTest.Missing.WindowProperties"));
+
+	bool threw = false;
+
+	try
+	{
+		(void)settings->Get<double>("Invasion_Default.PlayerProperties.NameTestMissing");
+	}
+	catch (const std::runtime_error&)
+	{
+		threw = true;
+	}
+
+	CHECK(threw);
+	CHECK(NameTable::GetInstance().Count() == count);
+}
\ No newline at end of file
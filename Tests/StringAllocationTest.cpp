@@ -0,0 +1,202 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+#include "Test.hpp"
+#include "ECS/GameObjectManager.hpp"
+#include "Util/XXML/Lexer.hpp"
+
+using namespace Invasion::ECS;
+using namespace Invasion::Util;
+
+namespace
+{
+	std::atomic<size_t> allocationCount = 0;
+
+	void* volatile allocationSink = nullptr;
+
+	class AllocationScope
+	{
+
+	public:
+
+		AllocationScope() : start(allocationCount.load()) { }
+
+		size_t GetCount() const
+		{
+			return allocationCount.load() - start;
+		}
+
+	private:
+
+		size_t start;
+
+	};
+
+	void* Allocate(std::size_t size)
+	{
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		if (void* pointer = std::malloc(size == 0 ? 1 : size))
+			return pointer;
+
+		throw std::bad_alloc();
+	}
+
+	void* AllocateAligned(std::size_t size, std::align_val_t alignment)
+	{
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		std::size_t align = static_cast<std::size_t>(alignment);
+
+		if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+			return pointer;
+
+		throw std::bad_alloc();
+	}
+}
+
+void* operator new(std::size_t size) { return Allocate(size); }
+void* operator new[](std::size_t size) { return Allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	try { return Allocate(size); } catch (...) { return nullptr; }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	try { return Allocate(size); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+INVASION_TEST(CounterSeesEveryAllocationForm)
+{
+	struct alignas(64) Wide
+	{
+		char bytes[64];
+	};
+
+	AllocationScope scope;
+
+	int* single = new int(1);
+	allocationSink = single;
+	int* array = new int[4];
+	allocationSink = array;
+	Wide* aligned = new Wide;
+	allocationSink = aligned;
+	Wide* alignedArray = new Wide[2];
+	allocationSink = alignedArray;
+	int* nothrow = new (std::nothrow) int[4];
+	allocationSink = nothrow;
+
+	CHECK(scope.GetCount() == 5);
+
+	delete single;
+	delete[] array;
+	delete aligned;
+	delete[] alignedArray;
+	delete[] nothrow;
+}
+
+INVASION_TEST(NarrowStringDoesNotAllocateAMutex)
+{
+	AllocationScope scope;
+
+	NarrowString empty;
+	NarrowString literal = "Invasion";
+	NarrowString copy = literal;
+	NarrowString moved = std::move(copy);
+
+	moved += '!';
+	literal = moved;
+
+	CHECK(scope.GetCount() == 0);
+	CHECK(literal == "Invasion!");
+}
+
+INVASION_TEST(SynchronizedStringIsOptIn)
+{
+	AllocationScope scope;
+
+	SynchronizedNarrowString synchronized = "Invasion";
+
+	CHECK(scope.GetCount() >= 1);
+	CHECK(synchronized[0] == 'I');
+
+	static_assert(std::is_same_v<decltype(std::declval<const SynchronizedNarrowString&>()[0]), char>);
+	static_assert(std::is_same_v<decltype(std::declval<SynchronizedNarrowString&>()[0]), char>);
+	static_assert(std::is_same_v<decltype(std::declval<NarrowString&>()[0]), char&>);
+}
+
+INVASION_TEST(LexingEngineSettingsAllocatesOnlyForLongTokens)
+{
+	NarrowString source = NarrowString(Invasion::Tests::ReadAsset("Invasion/EngineSettings.xxml"));
+
+	CHECK(!source.IsEmpty());
+
+	Shared<XXML::Lexer> lexer = XXML::Lexer::Create(source);
+
+	AllocationScope scope;
+
+	LocalArray<XXML::Token> tokens = lexer->Tokenize();
+
+	size_t allocations = scope.GetCount();
+	size_t longTokens = 0;
+
+	for (const XXML::Token& token : tokens.Read())
+	{
+		if (token.value.Length() > 15)
+			++longTokens;
+	}
+
+	std::printf("  %zu tokens, %zu long tokens, %zu allocations\n", tokens.Length(), longTokens, allocations);
+
+	CHECK(tokens.Length() > 0);
+	CHECK(allocations < tokens.Length());
+	CHECK(allocations <= 3 * longTokens + 16);
+}
+
+INVASION_TEST(GameObjectLookupDoesNotAllocate)
+{
+	Shared<GameObject> registered = GameObjectManager::GetInstance().Register(GameObject::Create("player"));
+
+	NarrowString key = "player";
+
+	AllocationScope scope;
+
+	Shared<GameObject> byLiteral = GameObjectManager::GetInstance().Get("player");
+	Shared<GameObject> byString = GameObjectManager::GetInstance().Get(key);
+
+	CHECK(scope.GetCount() == 0);
+	CHECK(byLiteral == registered);
+	CHECK(byString == registered);
+
+	GameObjectManager::GetInstance().Unregister("player");
+}
+
+INVASION_TEST(GameObjectLookupMissDoesNotIntern)
+{
+	size_t count = Types::BasicNameTable<char>::GetInstance().Count();
+
+	NarrowString key = "StringAllocationTest.Missing";
+
+	CHECK(GameObjectManager::GetInstance().Get("StringAllocationTest.Missing") == nullptr);
+	CHECK(GameObjectManager::GetInstance().Get(key) == nullptr);
+	CHECK(GameObjectManager::GetInstance().Get(std::string_view("StringAllocationTest.Missing")) == nullptr);
+
+	GameObjectManager::GetInstance().Unregister(key);
+
+	CHECK(Types::BasicNameTable<char>::GetInstance().Count() == count);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Invasion::Tests
+{
+	class TestRegistry
+	{
+
+	public:
+
+		static bool Register(std::string_view name, void (*function)())
+		{
+			GetTests().push_back({ name, function });
+
+			return true;
+		}
+
+		static void Fail(const char* expression, const char* file, int line)
+		{
+			std::printf("  %s:%d: CHECK(%s) failed\n", file, line, expression);
+
+			++failures;
+		}
+
+		static int Run()
+		{
+			size_t failedTests = 0;
+
+			for (const auto& [name, function] : GetTests())
+			{
+				size_t before = failures;
+
+				function();
+
+				bool passed = failures == before;
+
+				if (!passed)
+					++failedTests;
+
+				std::printf("[%s] %.*s\n", passed ? "  OK  " : " FAIL ", static_cast<int>(name.size()), name.data());
+			}
+
+			std::printf("%zu of %zu tests passed\n", GetTests().size() - failedTests, GetTests().size());
+
+			return failedTests == 0 ? 0 : 1;
+		}
+
+	private:
+
+		struct Entry
+		{
+			std::string_view name;
+			void (*function)();
+		};
+
+		static std::vector<Entry>& GetTests()
+		{
+			static std::vector<Entry> tests;
+
+			return tests;
+		}
+
+		static inline size_t failures = 0;
+
+	};
+
+	inline std::string ReadAsset(std::string_view path)
+	{
+		std::ifstream file(std::string(INVASION_ASSETS_DIRECTORY "/") + std::string(path));
+		std::stringstream stream;
+
+		stream << file.rdbuf();
+
+		return stream.str();
+	}
+
+	inline double RelativeError(double actual, double expected, double floor = 1.0)
+	{
+		return std::abs(actual - expected) / std::max(std::abs(expected), floor);
+	}
+}
+
+#define INVASION_TEST(name) \
+	static void name(); \
+	static const bool name##Registered = ::Invasion::Tests::TestRegistry::Register(#name, &name); \
+	static void name()
+
+#define CHECK(expression) \
+	do { if (!(expression)) ::Invasion::Tests::TestRegistry::Fail(#expression, __FILE__, __LINE__); } while (false)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+	CHECK(::Invasion::Tests::RelativeError(static_cast<double>(actual), static_cast<double>(expected)) <= (tolerance))
@@ -0,0 +1,6 @@
+#include "Test.hpp"
+
+int main()
+{
+	return Invasion::Tests::TestRegistry::Run();
+}
\ No newline at end of file
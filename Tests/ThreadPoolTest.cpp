@@ -0,0 +1,93 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "Test.hpp"
+#include "Util/Threading/ThreadPool.hpp"
+
+using namespace Invasion::Util::Threading;
+
+INVASION_TEST(ParallelForVisitsEveryIndexOnce)
+{
+	auto pool = ThreadPool::Create(4);
+
+	std::vector<std::atomic<int>> visits(10000);
+
+	pool->ParallelFor(visits.size(), 64, [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+			visits[i].fetch_add(1, std::memory_order_relaxed);
+	});
+
+	bool exact = true;
+
+	for (const auto& visit : visits)
+		exact = exact && visit.load() == 1;
+
+	CHECK(exact);
+}
+
+INVASION_TEST(ParallelForTreatsZeroGrainAsOne)
+{
+	auto pool = ThreadPool::Create(4);
+
+	std::vector<std::atomic<int>> visits(100);
+	std::atomic<size_t> largest = 0;
+
+	pool->ParallelFor(visits.size(), 0, [&](size_t begin, size_t end)
+	{
+		size_t length = end - begin;
+		size_t current = largest.load();
+
+		while (length > current && !largest.compare_exchange_weak(current, length));
+
+		for (size_t i = begin; i < end; ++i)
+			visits[i].fetch_add(1, std::memory_order_relaxed);
+	});
+
+	bool exact = true;
+
+	for (const auto& visit : visits)
+		exact = exact && visit.load() == 1;
+
+	CHECK(exact);
+	CHECK(largest == 1);
+}
+
+INVASION_TEST(ParallelForRethrowsJobExceptionsOnCaller)
+{
+	auto pool = ThreadPool::Create(4);
+
+	std::atomic<size_t> completed = 0;
+
+	bool threw = false;
+
+	try
+	{
+		pool->ParallelFor(4096, 16, [&](size_t begin, size_t end)
+		{
+			if (begin <= 1000 && 1000 < end)
+				throw std::runtime_error("job failed");
+
+			completed.fetch_add(end - begin, std::memory_order_relaxed);
+		});
+	}
+	catch (const std::runtime_error&)
+	{
+		threw = true;
+	}
+
+	CHECK(threw);
+	CHECK(completed.load() == 4096 - 16);
+
+	size_t total = 0;
+
+	pool->ParallelFor(4096, 16, [&](size_t begin, size_t end)
+	{
+		completed.fetch_add(end - begin, std::memory_order_relaxed);
+	});
+
+	total = completed.load();
+
+	CHECK(total == 4096 - 16 + 4096);
+}
\ No newline at end of file
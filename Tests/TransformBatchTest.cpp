@@ -0,0 +1,186 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Test.hpp"
+#include "Math/TransformBatch.hpp"
+
+using namespace Invasion::Math;
+
+namespace
+{
+	constexpr size_t ElementCount = 3 * TransformBatch::ParallelChunkSize + 13;
+	constexpr double Tolerance = 1e-5;
+
+	using Float4x4 = Matrix<float, 4, 4>;
+
+	struct Vertex
+	{
+		float position[3];
+		float normal[3];
+		float uv[2];
+	};
+
+	struct Streams
+	{
+		std::vector<float> x, y, z;
+
+		explicit Streams(size_t count) : x(count), y(count), z(count) { }
+	};
+
+	Float4x4 TestMatrix()
+	{
+		return Float4x4::Scale({ 2.0f, 0.5f, 3.0f }) * Float4x4::EulerRotation({ 30.0f, -45.0f, 60.0f }) * Float4x4::Translation({ 4.0f, -1.0f, 2.0f });
+	}
+
+	Streams RandomStreams(size_t count)
+	{
+		std::mt19937 random(11);
+		std::uniform_real_distribution<float> component(-10.0f, 10.0f);
+
+		Streams result(count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			result.x[i] = component(random);
+			result.y[i] = component(random);
+			result.z[i] = component(random);
+		}
+
+		return result;
+	}
+
+	Vector<float, 3> Reference(const Float4x4& matrix, float x, float y, float z, float w, bool normalize)
+	{
+		Matrix<float, 1, 4> row;
+
+		row(0, 0) = x;
+		row(0, 1) = y;
+		row(0, 2) = z;
+		row(0, 3) = w;
+
+		Matrix<float, 1, 4> product = row * matrix;
+
+		Vector<float, 3> result = { product(0, 0), product(0, 1), product(0, 2) };
+
+		return normalize ? result.Normalize() : result;
+	}
+
+	void CheckNear(float actual, float expected)
+	{
+		CHECK(std::abs(actual - expected) <= Tolerance * std::max(1.0f, std::abs(expected)));
+	}
+
+	void CheckStreams(const Float4x4& matrix, const Streams& input, const Streams& output, float w, bool normalize)
+	{
+		for (size_t i = 0; i < input.x.size(); ++i)
+		{
+			Vector<float, 3> expected = Reference(matrix, input.x[i], input.y[i], input.z[i], w, normalize);
+
+			CheckNear(output.x[i], expected[0]);
+			CheckNear(output.y[i], expected[1]);
+			CheckNear(output.z[i], expected[2]);
+		}
+	}
+
+	std::vector<Vertex> ToVertices(const Streams& streams)
+	{
+		std::vector<Vertex> result(streams.x.size());
+
+		for (size_t i = 0; i < result.size(); ++i)
+		{
+			result[i].position[0] = result[i].normal[0] = streams.x[i];
+			result[i].position[1] = result[i].normal[1] = streams.y[i];
+			result[i].position[2] = result[i].normal[2] = streams.z[i];
+			result[i].uv[0] = result[i].uv[1] = static_cast<float>(i);
+		}
+
+		return result;
+	}
+}
+
+INVASION_TEST(StreamsMatchMatrixProduct)
+{
+	Float4x4 matrix = TestMatrix();
+	Streams input = RandomStreams(ElementCount);
+	Streams output(ElementCount);
+
+	TransformBatch::TransformPoints(matrix, input.x.data(), input.y.data(), input.z.data(), output.x.data(), output.y.data(), output.z.data(), ElementCount);
+	CheckStreams(matrix, input, output, 1.0f, false);
+
+	TransformBatch::TransformDirections(matrix, input.x.data(), input.y.data(), input.z.data(), output.x.data(), output.y.data(), output.z.data(), ElementCount);
+	CheckStreams(matrix, input, output, 0.0f, false);
+
+	TransformBatch::TransformNormals(matrix, input.x.data(), input.y.data(), input.z.data(), output.x.data(), output.y.data(), output.z.data(), ElementCount);
+	CheckStreams(matrix.NormalMatrix(), input, output, 0.0f, true);
+}
+
+INVASION_TEST(StridedMatchesMatrixProduct)
+{
+	Float4x4 matrix = TestMatrix();
+	Streams input = RandomStreams(ElementCount);
+	std::vector<Vertex> vertices = ToVertices(input);
+
+	std::vector<Vertex> transformed = vertices;
+
+	TransformBatch::TransformPoints(matrix, &vertices[0].position, sizeof(Vertex), &transformed[0].position, sizeof(Vertex), ElementCount);
+	TransformBatch::TransformNormals(matrix, &vertices[0].normal, sizeof(Vertex), &transformed[0].normal, sizeof(Vertex), ElementCount);
+
+	Float4x4 normalMatrix = matrix.NormalMatrix();
+
+	for (size_t i = 0; i < ElementCount; ++i)
+	{
+		Vector<float, 3> position = Reference(matrix, input.x[i], input.y[i], input.z[i], 1.0f, false);
+		Vector<float, 3> normal = Reference(normalMatrix, input.x[i], input.y[i], input.z[i], 0.0f, true);
+
+		for (size_t c = 0; c < 3; ++c)
+		{
+			CheckNear(transformed[i].position[c], position[c]);
+			CheckNear(transformed[i].normal[c], normal[c]);
+		}
+
+		CHECK(transformed[i].uv[0] == static_cast<float>(i));
+	}
+}
+
+INVASION_TEST(NormalsOfZeroScaleStayFinite)
+{
+	Float4x4 matrix = Float4x4::Scale({ 1.0f, 0.0f, 1.0f });
+	Streams input = RandomStreams(16);
+	Streams output(16);
+
+	TransformBatch::TransformNormals(matrix, input.x.data(), input.y.data(), input.z.data(), output.x.data(), output.y.data(), output.z.data(), 16);
+
+	for (size_t i = 0; i < 16; ++i)
+		CHECK(std::isfinite(output.x[i]) && std::isfinite(output.y[i]) && std::isfinite(output.z[i]));
+}
+
+INVASION_TEST(PooledMatchesSerial)
+{
+	auto pool = Invasion::Util::Threading::ThreadPool::Create(4);
+
+	Float4x4 matrix = TestMatrix();
+	Streams input = RandomStreams(ElementCount);
+	Streams serial(ElementCount);
+	Streams pooled(ElementCount);
+
+	TransformBatch::TransformNormals(matrix, input.x.data(), input.y.data(), input.z.data(), serial.x.data(), serial.y.data(), serial.z.data(), ElementCount);
+	TransformBatch::TransformNormals(*pool, matrix, input.x.data(), input.y.data(), input.z.data(), pooled.x.data(), pooled.y.data(), pooled.z.data(), ElementCount);
+
+	CHECK(serial.x == pooled.x);
+	CHECK(serial.y == pooled.y);
+	CHECK(serial.z == pooled.z);
+
+	std::vector<Vertex> vertices = ToVertices(input);
+	std::vector<Vertex> transformed(ElementCount);
+
+	TransformBatch::TransformPoints(*pool, matrix, &vertices[0].position, sizeof(Vertex), &transformed[0].position, sizeof(Vertex), ElementCount);
+
+	for (size_t i = 0; i < ElementCount; ++i)
+	{
+		Vector<float, 3> expected = Reference(matrix, input.x[i], input.y[i], input.z[i], 1.0f, false);
+
+		for (size_t c = 0; c < 3; ++c)
+			CheckNear(transformed[i].position[c], expected[c]);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "Test.hpp"
+#include "Math/TransformHierarchy.hpp"
+
+using namespace Invasion::Math;
+
+namespace
+{
+	constexpr double Tolerance = 1e-5;
+
+	TransformHierarchy& Hierarchy()
+	{
+		return TransformHierarchy::GetInstance();
+	}
+
+	void CheckPosition(const Vector<float, 3>& actual, const Vector<float, 3>& expected)
+	{
+		for (size_t i = 0; i < 3; ++i)
+			CHECK(std::abs(actual[i] - expected[i]) <= Tolerance * std::max(1.0f, std::abs(expected[i])));
+	}
+}
+
+INVASION_TEST(WorldPositionFollowsNonUniformScale)
+{
+	uint32_t root = Hierarchy().Allocate();
+	uint32_t pivot = Hierarchy().Allocate();
+	uint32_t leaf = Hierarchy().Allocate();
+
+	Hierarchy().SetParent(pivot, root);
+	Hierarchy().SetParent(leaf, pivot);
+
+	Hierarchy().SetLocalScale(root, { 2.0f, 1.0f, 1.0f });
+	Hierarchy().SetLocalRotation(pivot, { 0.0f, 0.0f, 90.0f });
+	Hierarchy().SetLocalPosition(leaf, { 1.0f, 0.0f, 0.0f });
+
+	Hierarchy().Update();
+
+	Vector<float, 3> position = Hierarchy().GetWorldPosition(leaf);
+	Matrix<float, 4, 4> world = Hierarchy().GetWorldMatrix(leaf);
+
+	CheckPosition(position, world.TransformPoint({ 0.0f, 0.0f, 0.0f }));
+	CheckPosition(position, Hierarchy().GetWorldMatrix(pivot).TransformPoint({ 1.0f, 0.0f, 0.0f }));
+
+	CHECK(std::abs(position[0]) <= Tolerance);
+	CHECK(std::abs(std::abs(position[1]) - 1.0f) <= Tolerance);
+	CHECK(std::abs(position[2]) <= Tolerance);
+
+	Hierarchy().Release(leaf);
+	Hierarchy().Release(pivot);
+	Hierarchy().Release(root);
+}
+
+INVASION_TEST(WorldPositionMatchesMatrixAfterLazyResolve)
+{
+	uint32_t root = Hierarchy().Allocate();
+	uint32_t leaf = Hierarchy().Allocate();
+
+	Hierarchy().SetParent(leaf, root);
+	Hierarchy().Update();
+
+	Hierarchy().SetLocalScale(root, { 1.0f, 3.0f, 0.5f });
+	Hierarchy().SetLocalRotation(root, { 30.0f, 45.0f, 60.0f });
+	Hierarchy().SetLocalPosition(root, { 5.0f, -2.0f, 1.0f });
+	Hierarchy().SetLocalPosition(leaf, { 1.0f, 2.0f, 3.0f });
+
+	Vector<float, 3> position = Hierarchy().GetWorldPosition(leaf);
+
+	CheckPosition(position, Hierarchy().GetWorldMatrix(root).TransformPoint({ 1.0f, 2.0f, 3.0f }));
+
+	Hierarchy().Release(leaf);
+	Hierarchy().Release(root);
+}
+
+INVASION_TEST(NormalMatrixOfZeroScaleIsIdentity)
+{
+	uint32_t node = Hierarchy().Allocate();
+
+	Hierarchy().SetLocalScale(node, { 1.0f, 0.0f, 1.0f });
+	Hierarchy().Update();
+
+	CHECK(Hierarchy().GetNormalMatrix(node) == (Matrix<float, 4, 4>::Identity()));
+
+	Hierarchy().SetLocalScale(node, { 2.0f, 2.0f, 2.0f });
+	Hierarchy().Update();
+
+	CHECK(std::abs(Hierarchy().GetNormalMatrix(node)[0][0] - 0.5f) <= Tolerance);
+
+	Hierarchy().Release(node);
+}
+
+INVASION_TEST(ParallelUpdateSurvivesZeroScale)
+{
+	auto pool = Invasion::Util::Threading::ThreadPool::Create(4);
+
+	uint32_t root = Hierarchy().Allocate();
+
+	std::vector<uint32_t> children(4 * TransformHierarchy::ParallelGrainSize);
+
+	for (uint32_t& child : children)
+	{
+		child = Hierarchy().Allocate();
+
+		Hierarchy().SetParent(child, root);
+		Hierarchy().SetLocalPosition(child, { 1.0f, 0.0f, 0.0f });
+	}
+
+	Hierarchy().SetLocalScale(root, { 0.0f, 0.0f, 0.0f });
+
+	bool threw = false;
+
+	try
+	{
+		Hierarchy().Update(*pool);
+	}
+	catch (...)
+	{
+		threw = true;
+	}
+
+	CHECK(!threw);
+	CHECK(Hierarchy().GetNormalMatrix(children.back()) == (Matrix<float, 4, 4>::Identity()));
+	CheckPosition(Hierarchy().GetWorldPosition(children.back()), { 0.0f, 0.0f, 0.0f });
+
+	for (uint32_t child : children)
+		Hierarchy().Release(child);
+
+	Hierarchy().Release(root);
+}
+
+INVASION_TEST(ConcurrentReadersSeeResolvedWorld)
+{
+	uint32_t root = Hierarchy().Allocate();
+	uint32_t leaf = Hierarchy().Allocate();
+
+	Hierarchy().SetParent(leaf, root);
+	Hierarchy().SetLocalPosition(root, { 1.0f, 2.0f, 3.0f });
+	Hierarchy().SetLocalScale(root, { 2.0f, 2.0f, 2.0f });
+	Hierarchy().SetLocalPosition(leaf, { 1.0f, 0.0f, 0.0f });
+
+#ifdef INVASION_TRANSFORM_PHASE_CHECKED
+	const bool passes[] = { true };
+#else
+	const bool passes[] = { false, true };
+#endif
+
+	for (bool resolved : passes)
+	{
+		if (resolved)
+			Hierarchy().Update();
+
+		std::atomic<size_t> mismatches = 0;
+		std::vector<std::thread> readers;
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			readers.emplace_back([&]()
+			{
+				for (size_t k = 0; k < 1000; ++k)
+				{
+					Vector<float, 3> position = Hierarchy().GetWorldPosition(leaf);
+					Matrix<float, 4, 4> normal = Hierarchy().GetNormalMatrix(leaf);
+
+					if (std::abs(position[0] - 3.0f) > Tolerance || std::abs(normal[0][0] - 0.5f) > Tolerance)
+						++mismatches;
+				}
+			});
+		}
+
+		for (std::thread& reader : readers)
+			reader.join();
+
+		CHECK(mismatches == 0);
+	}
+
+	Hierarchy().Release(leaf);
+	Hierarchy().Release(root);
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include <stdexcept>
+
+#include "Test.hpp"
+#include "Math/Transform.hpp"
+
+using namespace Invasion::Math;
+
+INVASION_TEST(ReparentIntoCycleLeavesBothSidesUnchanged)
+{
+	auto root = Transform::Create();
+	auto child = Transform::Create();
+	auto grandchild = Transform::Create();
+
+	child->SetParent(root);
+	grandchild->SetParent(child);
+
+	bool threw = false;
+
+	try
+	{
+		child->SetParent(grandchild);
+	}
+	catch (const std::invalid_argument&)
+	{
+		threw = true;
+	}
+
+	CHECK(threw);
+	CHECK(child->GetParent() == root);
+	CHECK(root->GetChildren().Length() == 1);
+	CHECK(grandchild->GetParent() == child);
+	CHECK(grandchild->GetChildren().Length() == 0);
+	CHECK(child->GetChildren().Length() == 1);
+
+	child->SetParent(nullptr);
+
+	CHECK(child->GetParent() == nullptr);
+	CHECK(root->GetChildren().Length() == 0);
+}
+
+INVASION_TEST(ReparentMovesChildBetweenParents)
+{
+	auto first = Transform::Create();
+	auto second = Transform::Create();
+	auto child = Transform::Create();
+
+	child->SetParent(first);
+	child->SetParent(second);
+
+	CHECK(child->GetParent() == second);
+	CHECK(first->GetChildren().Length() == 0);
+	CHECK(second->GetChildren().Length() == 1);
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "Test.hpp"
+#include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+
+using namespace Invasion::Math;
+
+namespace
+{
+	constexpr double SinCosBound = 1e-7;
+	constexpr double AsinBound = 3e-7;
+	constexpr double Atan2Bound = 2.5e-6;
+	constexpr size_t SampleCount = 1 << 18;
+
+	std::vector<float> Angles(float range)
+	{
+		std::mt19937 random(3);
+		std::uniform_real_distribution<float> angle(-range, range);
+
+		std::vector<float> result(SampleCount);
+
+		for (float& value : result)
+			value = angle(random);
+
+		result[0] = 0.0f;
+		result[1] = std::numbers::pi_v<float> / 2.0f;
+		result[2] = -std::numbers::pi_v<float>;
+		result[3] = range;
+
+		return result;
+	}
+
+	double SinCosError(float angle, float sine, float cosine)
+	{
+		return std::max(std::abs(sine - std::sin(static_cast<double>(angle))), std::abs(cosine - std::cos(static_cast<double>(angle))));
+	}
+}
+
+INVASION_TEST(FastSinCosIsWithinBound)
+{
+	double worst = 0.0;
+
+	for (float angle : Angles(1e4f))
+	{
+		float sine, cosine;
+
+		Scalar::FastSinCos(angle, sine, cosine);
+
+		worst = std::max(worst, SinCosError(angle, sine, cosine));
+	}
+
+	CHECK(worst <= SinCosBound);
+}
+
+INVASION_TEST(SinCos4IsWithinBound)
+{
+	std::vector<float> angles = Angles(1e4f);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < angles.size(); i += 4)
+	{
+		Simd::Float4 sine, cosine;
+
+		Simd::SinCos4(Simd::Load<4>(angles.data() + i), sine, cosine);
+
+		float sines[4], cosines[4];
+
+		Simd::Store<4>(sines, sine);
+		Simd::Store<4>(cosines, cosine);
+
+		for (size_t k = 0; k < 4; ++k)
+			worst = std::max(worst, SinCosError(angles[i + k], sines[k], cosines[k]));
+	}
+
+	CHECK(worst <= SinCosBound);
+}
+
+#if INVASION_MATH_AVX2
+
+INVASION_TEST(SinCos8IsWithinBound)
+{
+	std::vector<float> angles = Angles(1e4f);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < angles.size(); i += 8)
+	{
+		__m256 sine, cosine;
+
+		Simd::SinCos8(_mm256_loadu_ps(angles.data() + i), sine, cosine);
+
+		float sines[8], cosines[8];
+
+		_mm256_storeu_ps(sines, sine);
+		_mm256_storeu_ps(cosines, cosine);
+
+		for (size_t k = 0; k < 8; ++k)
+			worst = std::max(worst, SinCosError(angles[i + k], sines[k], cosines[k]));
+	}
+
+	CHECK(worst <= SinCosBound);
+}
+
+#endif
+
+INVASION_TEST(BatchedSinCosIsWithinBound)
+{
+	std::vector<float> angles = Angles(1e4f);
+
+	angles.resize(angles.size() - 3);
+
+	std::vector<float> sines(angles.size()), cosines(angles.size());
+
+	Simd::SinCos(angles.data(), sines.data(), cosines.data(), angles.size());
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < angles.size(); ++i)
+		worst = std::max(worst, SinCosError(angles[i], sines[i], cosines[i]));
+
+	CHECK(worst <= SinCosBound);
+}
+
+INVASION_TEST(FastAsinIsWithinBound)
+{
+	double worst = 0.0;
+
+	for (size_t i = 0; i <= SampleCount; ++i)
+	{
+		float value = std::clamp(-1.0f + 2.0f * static_cast<float>(i) / SampleCount, -1.0f, 1.0f);
+
+		worst = std::max(worst, std::abs(Scalar::FastAsin(value) - std::asin(static_cast<double>(value))));
+	}
+
+	CHECK(worst <= AsinBound);
+	CHECK(std::isnan(Scalar::FastAsin(1.5f)));
+}
+
+INVASION_TEST(FastAtan2IsWithinBound)
+{
+	std::mt19937 random(5);
+	std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		float y = component(random);
+		float x = component(random);
+
+		worst = std::max(worst, std::abs(Scalar::FastAtan2(y, x) - std::atan2(static_cast<double>(y), static_cast<double>(x))));
+	}
+
+	CHECK(worst <= Atan2Bound);
+	CHECK(Scalar::FastAtan2(0.0f, 0.0f) == 0.0f);
+	CHECK(std::abs(Scalar::FastAtan2(1.0f, 0.0f) - std::numbers::pi_v<float> / 2.0f) <= Atan2Bound);
+	CHECK(std::abs(Scalar::FastAtan2(0.0f, -1.0f) - std::numbers::pi_v<float>) <= Atan2Bound);
+}
+
+INVASION_TEST(RotationBuildersMatchDoubleReference)
+{
+	std::mt19937 random(9);
+	std::uniform_real_distribution<float> angle(-180.0f, 180.0f);
+
+	double worst = 0.0;
+
+	for (size_t i = 0; i < 4096; ++i)
+	{
+		Vector<float, 3> angles = { angle(random), angle(random), angle(random) };
+
+		Matrix<float, 4, 4> actual = Matrix<float, 4, 4>::EulerRotation(angles);
+		Matrix<double, 4, 4> expected = Matrix<double, 4, 4>::EulerRotation({ angles[0], angles[1], angles[2] });
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+				worst = std::max(worst, std::abs(actual(row, column) - expected(row, column)));
+		}
+
+		Quaternion<float> rotation = Quaternion<float>::FromEuler(angles);
+		Quaternion<double> reference = Quaternion<double>::FromEuler({ angles[0], angles[1], angles[2] });
+
+		for (size_t k = 0; k < 4; ++k)
+			worst = std::max(worst, std::abs(rotation.GetVector()[k] - reference.GetVector()[k]));
+	}
+
+	CHECK(worst <= 1e-6);
+}
\ No newline at end of file